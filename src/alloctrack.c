@@ -0,0 +1,160 @@
+#include "alloctrack.h"
+
+// Compiled only with -DALLOC_TRACKING
+#ifdef ALLOC_TRACKING
+#include <stddef.h>
+#include <SDL2/SDL.h>
+
+// Number of steady scopes that allocated to report individually
+#define MAX_REPORTED 10
+
+typedef struct
+{
+    unsigned long long scopeCount;
+    unsigned long long allocCount;
+    unsigned long long byteCount;
+    unsigned long long maxAllocs;     // Most allocations in a single scope
+    unsigned long long steadyCount;   // Steady scopes that allocated
+    unsigned long long beginAllocs;   // Thread counters when the scope was opened
+    unsigned long long beginBytes;
+    unsigned long long beginScoped;
+    unsigned long long beginScopedBytes;
+} ScopeStats;
+
+// Internal variables
+// A scope is only opened by one thread at a time, and
+// the statistics are printed after the threads have finished
+static ScopeStats statsArr[cAllocScopeCount];
+static const char * const SCOPE_NAMES[cAllocScopeCount] = { "frame", "tick" };
+
+// Allocations made by the calling thread, and those
+// already counted by the scopes it has closed
+static __thread unsigned long long threadAllocs;
+static __thread unsigned long long threadBytes;
+static __thread unsigned long long scopedAllocs;
+static __thread unsigned long long scopedBytes;
+
+// Allocator wrappers, see -Wl,--wrap in alloctrack.h
+void * __real_malloc(size_t size);
+void * __real_calloc(size_t count, size_t size);
+void * __real_realloc(void * pMemory, size_t size);
+void __real_free(void * pMemory);
+
+void * __wrap_malloc(size_t size)
+{
+    threadAllocs++;
+    threadBytes += size;
+    return __real_malloc(size);
+}
+
+void * __wrap_calloc(size_t count, size_t size)
+{
+    threadAllocs++;
+    threadBytes += count * size;
+    return __real_calloc(count, size);
+}
+
+void * __wrap_realloc(void * pMemory, size_t size)
+{
+    threadAllocs++;
+    threadBytes += size;
+    return __real_realloc(pMemory, size);
+}
+
+void __wrap_free(void * pMemory)
+{
+    __real_free(pMemory);
+}
+
+// SDL's allocator hooks, counted like the game's own calls
+static void * SDLCALL SdlMalloc(size_t size)
+{
+    return __wrap_malloc(size);
+}
+
+static void * SDLCALL SdlCalloc(size_t count, size_t size)
+{
+    return __wrap_calloc(count, size);
+}
+
+static void * SDLCALL SdlRealloc(void * pMemory, size_t size)
+{
+    return __wrap_realloc(pMemory, size);
+}
+
+static void SDLCALL SdlFree(void * pMemory)
+{
+    __wrap_free(pMemory);
+}
+
+// Public functions
+
+// "Constructor"
+// Route SDL's allocations through the counters
+// Must be called before SDL_Init(), so SDL frees nothing it allocated before
+void AllocTrackInitialise(void)
+{
+    SDL_SetMemoryFunctions(SdlMalloc, SdlCalloc, SdlRealloc, SdlFree);
+}
+
+// Print the allocations of every scope
+void AllocTrackPrint(FILE * pFile)
+{
+    for(uint scope = 0; scope < cAllocScopeCount; scope++)
+    {
+        const ScopeStats * pStats = &statsArr[scope];
+        const double PER_SCOPE = (pStats->scopeCount > 0) ? (double)pStats->allocCount / pStats->scopeCount : 0.0;
+        const double BYTES_PER_SCOPE = (pStats->scopeCount > 0) ? (double)pStats->byteCount / pStats->scopeCount : 0.0;
+        fprintf(pFile, "%s allocations: %llu in %llu %ss (%.3f, %.1f bytes per %s), max %llu, %llu steady %ss allocated\n",
+                SCOPE_NAMES[scope], pStats->allocCount, pStats->scopeCount, SCOPE_NAMES[scope], PER_SCOPE, BYTES_PER_SCOPE,
+                SCOPE_NAMES[scope], pStats->maxAllocs, pStats->steadyCount, SCOPE_NAMES[scope]);
+    }
+}
+
+// Start counting the allocations of the calling thread for 'scope'
+void AllocTrackBegin(const AllocScope scope)
+{
+    statsArr[scope].beginAllocs      = threadAllocs;
+    statsArr[scope].beginBytes       = threadBytes;
+    statsArr[scope].beginScoped      = scopedAllocs;
+    statsArr[scope].beginScopedBytes = scopedBytes;
+}
+
+// Add the allocations since AllocTrackBegin() to the statistics
+// Those of scopes opened and closed in between are left out, so a frame
+// does not count the ticks run by the game loop without a simulation thread
+// A steady scope that allocated is reported, the first few on stdout
+void AllocTrackEnd(const AllocScope scope, const BOOL isSteady)
+{
+    ScopeStats * pStats = &statsArr[scope];
+    const unsigned long long ALLOCS = (threadAllocs - pStats->beginAllocs) - (scopedAllocs - pStats->beginScoped);
+    const unsigned long long BYTES  = (threadBytes - pStats->beginBytes) - (scopedBytes - pStats->beginScopedBytes);
+    scopedAllocs += ALLOCS;
+    scopedBytes  += BYTES;
+    pStats->scopeCount++;
+    pStats->allocCount += ALLOCS;
+    pStats->byteCount  += BYTES;
+    pStats->maxAllocs   = (ALLOCS > pStats->maxAllocs) ? ALLOCS : pStats->maxAllocs;
+    if(isSteady && ALLOCS > 0)
+    {
+        if(pStats->steadyCount < MAX_REPORTED)
+        {
+            printf("Steady %s %llu allocated %llu times (%llu bytes)\n", SCOPE_NAMES[scope], pStats->scopeCount, ALLOCS, BYTES);
+        }
+        pStats->steadyCount++;
+    }
+}
+
+// Return TRUE if any steady scope has allocated
+BOOL AllocTrackHasSteadyAllocations(void)
+{
+    for(uint scope = 0; scope < cAllocScopeCount; scope++)
+    {
+        if(statsArr[scope].steadyCount > 0)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+#endif // ALLOC_TRACKING
@@ -0,0 +1,47 @@
+#ifndef ALLOCTRACK_H
+#define ALLOCTRACK_H
+
+#include "types.h"
+
+// Allocation tracking
+//
+// Build with -DALLOC_TRACKING and link with
+// -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free
+// to count the heap allocations of every frame and every tick.
+// The game's own calls are counted by the wrappers, and SDL's
+// through SDL_SetMemoryFunctions(); libraries that call the C
+// allocator directly (FreeType, the GPU driver) are not seen.
+//
+// Counts are kept per thread, so a scope only counts the allocations
+// made by the thread that opened it. A steady scope is one that should
+// never allocate, such as a play frame after the first one; the process
+// exits with an error if any of them did. 'make -f makefile_unix
+// alloc_check' builds the game this way and plays it by itself, see
+// GameSetAutoplay(). Without ALLOC_TRACKING the macros compile to nothing
+#ifdef ALLOC_TRACKING
+#include <stdio.h>
+
+typedef enum
+{
+    cAllocScopeFrame = 0,
+    cAllocScopeTick  = 1,
+    cAllocScopeCount = 2,
+} AllocScope;
+
+#define ALLOC_SCOPE_BEGIN(scope)          AllocTrackBegin(scope)
+#define ALLOC_SCOPE_END(scope, isSteady)  AllocTrackEnd(scope, isSteady)
+
+// Main functions
+void AllocTrackInitialise(void);
+void AllocTrackPrint(FILE * pFile);
+
+// Helper functions
+void AllocTrackBegin(const AllocScope scope);
+void AllocTrackEnd(const AllocScope scope, const BOOL isSteady);
+BOOL AllocTrackHasSteadyAllocations(void);
+#else
+#define ALLOC_SCOPE_BEGIN(scope)
+#define ALLOC_SCOPE_END(scope, isSteady)  ((void)sizeof(isSteady))  // Keeps the condition "used", without evaluating it
+#endif // ALLOC_TRACKING
+
+#endif // !ALLOCTRACK_H
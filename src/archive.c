@@ -0,0 +1,616 @@
+// Needed for mmap(), fseeko() and ftruncate() with -std=c99
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif // !_WIN32
+
+#include "archive.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif // _WIN32
+
+// Archive format version
+// Stored next to REPLAY_VERSION, an archive is rejected if either differs
+#define ARCHIVE_VERSION 1
+
+#define HEADER_SIZE        16   // Magic, archive version, replay version
+#define RECORD_HEADER_SIZE 8    // Payload size, payload checksum
+#define TRAILER_SIZE       24   // Index offset, entry count, reserved, magic
+#define MAX_VARINT_SIZE    5
+
+static const char HEADER_MAGIC[8]  = { 'R', 'S', 'A', 'R', 'C', 'H', 'I', 'V' };
+static const char TRAILER_MAGIC[8] = { 'R', 'S', 'I', 'N', 'D', 'E', 'X', '\0' };
+
+// The index is used in place, so its layout must not depend on the compiler
+typedef char ArchiveEntrySizeCheck[(sizeof(ArchiveEntry) == 32) ? 1 : -1];
+
+// Internal functions
+
+// Return TRUE if the host stores integers little-endian
+static inline BOOL IsLittleEndian(void)
+{
+    const uint16_t VALUE = 1;
+    uchar byte;
+    memcpy(&byte, &VALUE, 1);
+    return byte == 1;
+}
+
+static inline uint32_t ReadU32(const uchar * p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint64_t ReadU64(const uchar * p)
+{
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline void WriteU32(uchar * p, const uint32_t value)
+{
+    memcpy(p, &value, sizeof(value));
+}
+
+static inline void WriteU64(uchar * p, const uint64_t value)
+{
+    memcpy(p, &value, sizeof(value));
+}
+
+// FNV-1a, used to find the last intact record when rebuilding the index
+static uint32_t Checksum(const uchar * p, const size_t size)
+{
+    uint32_t hash = 2166136261u;
+    for(size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ p[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Write 'value' in 7-bit groups, lowest first
+// Return the position after the last byte
+static inline uchar * PutVarint(uchar * p, uint value)
+{
+    while(value >= 0x80)
+    {
+        *p++ = (uchar)(value | 0x80);
+        value >>= 7;
+    }
+    *p++ = (uchar)value;
+    return p;
+}
+
+// Read a value written by PutVarint()
+// Return the position after the last byte, NULL if the data is malformed
+static inline const uchar * GetVarint(const uchar * p, const uchar * pEnd, uint * pValue)
+{
+    uint value = 0;
+    for(uint shift = 0; p < pEnd && shift < 7 * MAX_VARINT_SIZE; shift += 7)
+    {
+        const uchar BYTE = *p++;
+        value |= (uint)(BYTE & 0x7F) << shift;
+        if(!(BYTE & 0x80))
+        {
+            *pValue = value;
+            return p;
+        }
+    }
+    return NULL;
+}
+
+// Directions are stored in two bits
+// Up, Down, Left, Right (0, 1, 3, 4) become 0, 1, 2, 3
+static inline uint DirectionToCode(const Direction direction)
+{
+    return (uint)direction - (direction > cDirectionDown);
+}
+
+static inline Direction CodeToDirection(const uint code)
+{
+    return (Direction)(code + (code > cDirectionDown));
+}
+
+// Encode a game into pOut, which must hold 8 + inputCount varints
+// Return the encoded size, 0 if the game cannot be stored
+// Records have no field for wrapping, so those games cannot
+static size_t EncodeReplay(uchar * pOut, const uint gameId, const Replay * pReplay)
+{
+    if(pReplay->isWrapping)
+    {
+        return 0;
+    }
+    uchar * p = pOut;
+    p = PutVarint(p, gameId);
+    p = PutVarint(p, pReplay->seed);
+    p = PutVarint(p, pReplay->width);
+    p = PutVarint(p, pReplay->height);
+    p = PutVarint(p, pReplay->tickCount);
+    p = PutVarint(p, pReplay->score);
+    p = PutVarint(p, (uint)pReplay->result);
+    p = PutVarint(p, pReplay->inputCount);
+
+    uint lastTick = 0;
+    for(uint i = 0; i < pReplay->inputCount; i++)
+    {
+        const ReplayInput INPUT = pReplay->pInputArr[i];
+        const Direction DIRECTION = INPUT.direction;
+        if(INPUT.tick < lastTick || INPUT.tick - lastTick > (UINT32_MAX >> 2)
+        || (DIRECTION != cDirectionUp && DIRECTION != cDirectionDown
+         && DIRECTION != cDirectionLeft && DIRECTION != cDirectionRight))
+        {
+            return 0;
+        }
+        p = PutVarint(p, ((INPUT.tick - lastTick) << 2) | DirectionToCode(DIRECTION));
+        lastTick = INPUT.tick;
+    }
+    return (size_t)(p - pOut);
+}
+
+// Decode the fields stored in the index
+// Return the position of the inputs, NULL if the data is malformed
+static const uchar * DecodeEntry(const uchar * p, const uchar * pEnd, ArchiveEntry * pEntry, uint * pResult, uint * pInputCount)
+{
+    uint gameId, seed, width, height, tickCount, score;
+    if(!(p = GetVarint(p, pEnd, &gameId)) || !(p = GetVarint(p, pEnd, &seed))
+    || !(p = GetVarint(p, pEnd, &width)) || !(p = GetVarint(p, pEnd, &height))
+    || !(p = GetVarint(p, pEnd, &tickCount)) || !(p = GetVarint(p, pEnd, &score))
+    || !(p = GetVarint(p, pEnd, pResult)) || !(p = GetVarint(p, pEnd, pInputCount))
+    || width > UINT16_MAX || height > UINT16_MAX)
+    {
+        return NULL;
+    }
+    pEntry->gameId    = gameId;
+    pEntry->seed      = seed;
+    pEntry->score     = score;
+    pEntry->tickCount = tickCount;
+    pEntry->width     = (uint16_t)width;
+    pEntry->height    = (uint16_t)height;
+    return p;
+}
+
+// Return TRUE if the header belongs to an archive this build can read
+static BOOL IsValidHeader(const uchar * pHeader)
+{
+    return memcmp(pHeader, HEADER_MAGIC, sizeof(HEADER_MAGIC)) == 0
+        && ReadU32(pHeader + 8) == ARCHIVE_VERSION
+        && ReadU32(pHeader + 12) == REPLAY_VERSION;
+}
+
+// Check the trailer at the end of a file of 'size' bytes
+// Return the number of index entries, or -1 if the trailer is invalid
+static long long ParseTrailer(const uchar * pTrailer, const uint64_t size, uint64_t * pIndexOffset)
+{
+    const uint64_t INDEX_OFFSET = ReadU64(pTrailer);
+    const uint64_t COUNT = ReadU32(pTrailer + 8);
+    if(memcmp(pTrailer + 16, TRAILER_MAGIC, sizeof(TRAILER_MAGIC)) != 0
+    || INDEX_OFFSET % 8 != 0 || INDEX_OFFSET < HEADER_SIZE || INDEX_OFFSET > size - TRAILER_SIZE
+    || size - TRAILER_SIZE - INDEX_OFFSET != COUNT * sizeof(ArchiveEntry))
+    {
+        return -1;
+    }
+    *pIndexOffset = INDEX_OFFSET;
+    return (long long)COUNT;
+}
+
+#ifdef _WIN32
+static inline int SeekTo(FILE * pFile, const uint64_t offset)
+{
+    return _fseeki64(pFile, (__int64)offset, SEEK_SET);
+}
+
+static inline uint64_t GetFileSize(FILE * pFile)
+{
+    _fseeki64(pFile, 0, SEEK_END);
+    return (uint64_t)_ftelli64(pFile);
+}
+
+static inline BOOL TruncateFile(FILE * pFile, const uint64_t size)
+{
+    return _chsize_s(_fileno(pFile), (__int64)size) == 0;
+}
+#else
+static inline int SeekTo(FILE * pFile, const uint64_t offset)
+{
+    return fseeko(pFile, (off_t)offset, SEEK_SET);
+}
+
+static inline uint64_t GetFileSize(FILE * pFile)
+{
+    fseeko(pFile, 0, SEEK_END);
+    return (uint64_t)ftello(pFile);
+}
+
+static inline BOOL TruncateFile(FILE * pFile, const uint64_t size)
+{
+    return ftruncate(fileno(pFile), (off_t)size) == 0;
+}
+#endif // _WIN32
+
+// Map the whole file read only
+// Return FALSE if the file cannot be mapped
+static BOOL MapFile(Archive * pArchive, const char * pPath)
+{
+#ifdef _WIN32
+    HANDLE hFile = CreateFileA(pPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(hFile == INVALID_HANDLE_VALUE)
+    {
+        return FALSE;
+    }
+    LARGE_INTEGER size;
+    HANDLE hMapping = NULL;
+    if(GetFileSizeEx(hFile, &size) && size.QuadPart > 0)
+    {
+        hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    }
+    void * pData = (hMapping) ? MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if(!pData)
+    {
+        if(hMapping)
+        {
+            CloseHandle(hMapping);
+        }
+        CloseHandle(hFile);
+        return FALSE;
+    }
+    pArchive->hFile    = hFile;
+    pArchive->hMapping = hMapping;
+    pArchive->pData    = (const uchar *)pData;
+    pArchive->size     = (size_t)size.QuadPart;
+#else
+    const int FD = open(pPath, O_RDONLY);
+    if(FD < 0)
+    {
+        return FALSE;
+    }
+    struct stat info;
+    void * pData = MAP_FAILED;
+    if(fstat(FD, &info) == 0 && info.st_size > 0)
+    {
+        pData = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, FD, 0);
+    }
+    close(FD);
+    if(pData == MAP_FAILED)
+    {
+        return FALSE;
+    }
+    pArchive->pData = (const uchar *)pData;
+    pArchive->size  = (size_t)info.st_size;
+#endif // _WIN32
+    return TRUE;
+}
+
+// Read the index of an existing archive into the writer
+// Return FALSE if the index is missing or invalid
+static BOOL LoadIndex(ArchiveWriter * pWriter, const uint64_t size)
+{
+    uchar trailer[TRAILER_SIZE];
+    uint64_t indexOffset = 0;
+    if(size < HEADER_SIZE + TRAILER_SIZE || SeekTo(pWriter->pFile, size - TRAILER_SIZE) != 0
+    || fread(trailer, 1, TRAILER_SIZE, pWriter->pFile) != TRAILER_SIZE)
+    {
+        return FALSE;
+    }
+    const long long COUNT = ParseTrailer(trailer, size, &indexOffset);
+    if(COUNT < 0)
+    {
+        return FALSE;
+    }
+
+    pWriter->pEntryArr = (ArchiveEntry *)malloc(((COUNT > 0) ? COUNT : 1) * sizeof(ArchiveEntry));
+    if(!pWriter->pEntryArr || SeekTo(pWriter->pFile, indexOffset) != 0
+    || fread(pWriter->pEntryArr, sizeof(ArchiveEntry), (size_t)COUNT, pWriter->pFile) != (size_t)COUNT)
+    {
+        return FALSE;
+    }
+    pWriter->entryCount    = (uint)COUNT;
+    pWriter->entryCapacity = (COUNT > 0) ? (uint)COUNT : 1;
+    pWriter->offset        = HEADER_SIZE;
+    if(COUNT > 0)
+    {
+        const ArchiveEntry * pLast = &pWriter->pEntryArr[COUNT - 1];
+        pWriter->offset = pLast->offset + pLast->size;
+    }
+    return TRUE;
+}
+
+// Grow the writer arrays to hold one more entry and 'bufferSize' bytes
+// Return FALSE if out of memory
+static BOOL Reserve(ArchiveWriter * pWriter, const size_t bufferSize)
+{
+    if(pWriter->entryCount == pWriter->entryCapacity)
+    {
+        const uint NEW_CAPACITY = (pWriter->entryCapacity == 0) ? 1024 : pWriter->entryCapacity * 2;
+        ArchiveEntry * pNewArr = (ArchiveEntry *)realloc(pWriter->pEntryArr, NEW_CAPACITY * sizeof(ArchiveEntry));
+        if(!pNewArr)
+        {
+            return FALSE;
+        }
+        pWriter->pEntryArr     = pNewArr;
+        pWriter->entryCapacity = NEW_CAPACITY;
+    }
+    if(bufferSize > pWriter->bufferCapacity)
+    {
+        const size_t NEW_CAPACITY = (bufferSize > 2 * pWriter->bufferCapacity) ? bufferSize : 2 * pWriter->bufferCapacity;
+        uchar * pNewBuffer = (uchar *)realloc(pWriter->pBuffer, NEW_CAPACITY);
+        if(!pNewBuffer)
+        {
+            return FALSE;
+        }
+        pWriter->pBuffer        = pNewBuffer;
+        pWriter->bufferCapacity = NEW_CAPACITY;
+    }
+    return TRUE;
+}
+
+// Rebuild the index from the records, e.g. after a crash
+// Scanning stops at the first truncated or damaged record
+static void RebuildIndex(ArchiveWriter * pWriter, const uint64_t size)
+{
+    pWriter->entryCount = 0;
+    pWriter->offset     = HEADER_SIZE;
+    while(pWriter->offset + RECORD_HEADER_SIZE <= size)
+    {
+        uchar header[RECORD_HEADER_SIZE];
+        if(SeekTo(pWriter->pFile, pWriter->offset) != 0
+        || fread(header, 1, RECORD_HEADER_SIZE, pWriter->pFile) != RECORD_HEADER_SIZE)
+        {
+            return;
+        }
+        const uint32_t RECORD_SIZE = ReadU32(header);
+        if(RECORD_SIZE == 0 || RECORD_SIZE > size - pWriter->offset - RECORD_HEADER_SIZE
+        || !Reserve(pWriter, RECORD_SIZE)
+        || fread(pWriter->pBuffer, 1, RECORD_SIZE, pWriter->pFile) != RECORD_SIZE
+        || Checksum(pWriter->pBuffer, RECORD_SIZE) != ReadU32(header + 4))
+        {
+            return;
+        }
+
+        ArchiveEntry entry;
+        uint result, inputCount;
+        if(!DecodeEntry(pWriter->pBuffer, pWriter->pBuffer + RECORD_SIZE, &entry, &result, &inputCount))
+        {
+            return;
+        }
+        entry.offset = pWriter->offset + RECORD_HEADER_SIZE;
+        entry.size   = RECORD_SIZE;
+        pWriter->pEntryArr[pWriter->entryCount++] = entry;
+        pWriter->offset += RECORD_HEADER_SIZE + RECORD_SIZE;
+    }
+}
+
+// Public functions
+
+// Map an archive for reading
+// Return FALSE if the file cannot be mapped or is not a valid archive
+BOOL ArchiveOpen(Archive * pArchive, const char * pPath)
+{
+    memset(pArchive, 0, sizeof(Archive));
+    if(!IsLittleEndian() || !MapFile(pArchive, pPath))
+    {
+        return FALSE;
+    }
+
+    uint64_t indexOffset = 0;
+    const long long COUNT = (pArchive->size >= HEADER_SIZE + TRAILER_SIZE && IsValidHeader(pArchive->pData))
+                          ? ParseTrailer(pArchive->pData + pArchive->size - TRAILER_SIZE, pArchive->size, &indexOffset)
+                          : -1;
+    if(COUNT < 0)
+    {
+        ArchiveClose(pArchive);
+        return FALSE;
+    }
+    pArchive->pEntryArr  = (const ArchiveEntry *)(pArchive->pData + indexOffset);
+    pArchive->entryCount = (uint)COUNT;
+    return TRUE;
+}
+
+// Unmap the archive
+void ArchiveClose(Archive * pArchive)
+{
+    if(pArchive->pData)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(pArchive->pData);
+        CloseHandle(pArchive->hMapping);
+        CloseHandle(pArchive->hFile);
+#else
+        munmap((void *)pArchive->pData, pArchive->size);
+#endif // _WIN32
+    }
+    memset(pArchive, 0, sizeof(Archive));
+}
+
+// Find a game in the index
+// Return NULL if there is no game with that id
+const ArchiveEntry * ArchiveFindGame(const Archive * pArchive, const uint gameId)
+{
+    uint low = 0;
+    uint high = pArchive->entryCount;
+    while(low < high)
+    {
+        const uint MIDDLE = low + (high - low) / 2;
+        if(pArchive->pEntryArr[MIDDLE].gameId < gameId)
+        {
+            low = MIDDLE + 1;
+        }
+        else
+        {
+            high = MIDDLE;
+        }
+    }
+    return (low < pArchive->entryCount && pArchive->pEntryArr[low].gameId == gameId)
+        ? &pArchive->pEntryArr[low] : NULL;
+}
+
+// Decode a game straight from the mapping
+// The input array of pReplay is reused, so one Replay can stream a whole archive
+// Return FALSE if the record is malformed
+BOOL ArchiveReadReplay(const Archive * pArchive, const ArchiveEntry * pEntry, Replay * pReplay)
+{
+    if(pEntry->offset > pArchive->size || pEntry->size > pArchive->size - pEntry->offset)
+    {
+        return FALSE;
+    }
+    const uchar * p    = pArchive->pData + pEntry->offset;
+    const uchar * pEnd = p + pEntry->size;
+
+    ArchiveEntry entry;
+    uint result, inputCount;
+    if(!(p = DecodeEntry(p, pEnd, &entry, &result, &inputCount)) || inputCount > pEntry->size)
+    {
+        return FALSE;
+    }
+    pReplay->seed       = entry.seed;
+    pReplay->width      = entry.width;
+    pReplay->height     = entry.height;
+    pReplay->isWrapping = FALSE;
+    pReplay->tickCount  = entry.tickCount;
+    pReplay->score      = entry.score;
+    pReplay->result     = (TickResult)result;
+    pReplay->inputCount = 0;
+
+    uint tick = 0;
+    for(uint i = 0; i < inputCount; i++)
+    {
+        uint value;
+        if(!(p = GetVarint(p, pEnd, &value)))
+        {
+            return FALSE;
+        }
+        tick += value >> 2;
+        ReplayAddInput(pReplay, tick, CodeToDirection(value & 3));
+    }
+    return p == pEnd && pReplay->inputCount == inputCount;
+}
+
+// Open an archive for appending, creating it if needed
+// A missing index is rebuilt from the records
+// Return FALSE if the file cannot be opened or is not an archive
+BOOL ArchiveWriterOpen(ArchiveWriter * pWriter, const char * pPath)
+{
+    memset(pWriter, 0, sizeof(ArchiveWriter));
+    if(!IsLittleEndian())
+    {
+        return FALSE;
+    }
+    pWriter->pFile = fopen(pPath, "r+b");
+    if(!pWriter->pFile)
+    {
+        pWriter->pFile = fopen(pPath, "w+b");
+    }
+    if(!pWriter->pFile)
+    {
+        return FALSE;
+    }
+
+    BOOL isOpen = TRUE;
+    uchar header[HEADER_SIZE];
+    const uint64_t SIZE = GetFileSize(pWriter->pFile);
+    if(SIZE == 0)
+    {
+        // New archive
+        memcpy(header, HEADER_MAGIC, sizeof(HEADER_MAGIC));
+        WriteU32(header + 8, ARCHIVE_VERSION);
+        WriteU32(header + 12, REPLAY_VERSION);
+        isOpen = SeekTo(pWriter->pFile, 0) == 0 && fwrite(header, 1, HEADER_SIZE, pWriter->pFile) == HEADER_SIZE;
+        pWriter->offset = HEADER_SIZE;
+    }
+    else if(SeekTo(pWriter->pFile, 0) != 0 || fread(header, 1, HEADER_SIZE, pWriter->pFile) != HEADER_SIZE
+         || !IsValidHeader(header))
+    {
+        isOpen = FALSE;
+    }
+    else if(!LoadIndex(pWriter, SIZE))
+    {
+        RebuildIndex(pWriter, SIZE);
+    }
+
+    // Records are appended after the last one, the index is written on close
+    if(!isOpen || SeekTo(pWriter->pFile, pWriter->offset) != 0)
+    {
+        fclose(pWriter->pFile);
+        pWriter->pFile = NULL;
+        ArchiveWriterClose(pWriter);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+// Append a finished game
+// It gets the next game id; records reach the disk as the file is flushed
+// Return FALSE on write error or if the game cannot be stored
+BOOL ArchiveWriterAppend(ArchiveWriter * pWriter, const Replay * pReplay)
+{
+    if(!Reserve(pWriter, RECORD_HEADER_SIZE + (8 + (size_t)pReplay->inputCount) * MAX_VARINT_SIZE))
+    {
+        return FALSE;
+    }
+    const uint GAME_ID = (pWriter->entryCount > 0) ? pWriter->pEntryArr[pWriter->entryCount - 1].gameId + 1 : 0;
+    const size_t SIZE = EncodeReplay(pWriter->pBuffer + RECORD_HEADER_SIZE, GAME_ID, pReplay);
+    if(SIZE == 0)
+    {
+        return FALSE;
+    }
+    WriteU32(pWriter->pBuffer, (uint32_t)SIZE);
+    WriteU32(pWriter->pBuffer + 4, Checksum(pWriter->pBuffer + RECORD_HEADER_SIZE, SIZE));
+    if(fwrite(pWriter->pBuffer, 1, RECORD_HEADER_SIZE + SIZE, pWriter->pFile) != RECORD_HEADER_SIZE + SIZE)
+    {
+        // Drop the partial record
+        SeekTo(pWriter->pFile, pWriter->offset);
+        return FALSE;
+    }
+
+    ArchiveEntry * pEntry = &pWriter->pEntryArr[pWriter->entryCount++];
+    pEntry->offset    = pWriter->offset + RECORD_HEADER_SIZE;
+    pEntry->size      = (uint32_t)SIZE;
+    pEntry->gameId    = GAME_ID;
+    pEntry->seed      = pReplay->seed;
+    pEntry->score     = pReplay->score;
+    pEntry->tickCount = pReplay->tickCount;
+    pEntry->width     = pReplay->width;
+    pEntry->height    = pReplay->height;
+    pWriter->offset  += RECORD_HEADER_SIZE + SIZE;
+    return TRUE;
+}
+
+// Write the index and close the file
+// Return FALSE if the index could not be written
+BOOL ArchiveWriterClose(ArchiveWriter * pWriter)
+{
+    BOOL isWritten = FALSE;
+    if(pWriter->pFile)
+    {
+        static const uchar PADDING[8] = { 0 };
+        const uint64_t INDEX_OFFSET = (pWriter->offset + 7) & ~(uint64_t)7;
+        const uint64_t END = INDEX_OFFSET + (uint64_t)pWriter->entryCount * sizeof(ArchiveEntry) + TRAILER_SIZE;
+        uchar trailer[TRAILER_SIZE] = { 0 };
+        WriteU64(trailer, INDEX_OFFSET);
+        WriteU32(trailer + 8, pWriter->entryCount);
+        memcpy(trailer + 16, TRAILER_MAGIC, sizeof(TRAILER_MAGIC));
+
+        const size_t PADDING_SIZE = (size_t)(INDEX_OFFSET - pWriter->offset);
+        isWritten = SeekTo(pWriter->pFile, pWriter->offset) == 0
+                 && fwrite(PADDING, 1, PADDING_SIZE, pWriter->pFile) == PADDING_SIZE
+                 && fwrite(pWriter->pEntryArr, sizeof(ArchiveEntry), pWriter->entryCount, pWriter->pFile) == pWriter->entryCount
+                 && fwrite(trailer, 1, TRAILER_SIZE, pWriter->pFile) == TRAILER_SIZE
+                 && fflush(pWriter->pFile) == 0
+                 && TruncateFile(pWriter->pFile, END);
+        fclose(pWriter->pFile);
+    }
+    free(pWriter->pEntryArr);
+    free(pWriter->pBuffer);
+    memset(pWriter, 0, sizeof(ArchiveWriter));
+    return isWritten;
+}
@@ -0,0 +1,78 @@
+#ifndef ARCHIVE_H
+#define ARCHIVE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "types.h"
+#include "replay.h"
+
+// Replay archive
+//
+// One append-only binary file holding any number of games.
+// Layout:
+//   header   "RSARCHIV", archive version, replay version
+//   records  uint32 size + compressed game, one per game
+//   index    ArchiveEntry per game, sorted by game id, 8-byte aligned
+//   trailer  index offset, entry count, "RSINDEX"
+//
+// Games are compressed with varints; each input is stored as the tick
+// delta to the previous input and a 2-bit direction, usually in one byte.
+// The reader maps the whole file, so the index is used in place and any
+// game can be decoded without reading the ones before it.
+// Writing appends records over the old index and writes a new one on close;
+// if the index was lost (e.g. a crash), it is rebuilt from the records.
+// Entries are stored in host order, so only little-endian hosts are supported.
+// Games on a wrapping board cannot be stored
+
+// Index entry, 32 bytes
+typedef struct
+{
+    uint64_t offset;     // Record payload offset from the start of the file
+    uint32_t size;       // Record payload size in bytes
+    uint32_t gameId;
+    uint32_t seed;
+    uint32_t score;
+    uint32_t tickCount;  // Game length
+    uint16_t width;
+    uint16_t height;
+} ArchiveEntry;
+
+// Mapped archive, read only
+typedef struct
+{
+    const uchar *        pData;
+    size_t               size;
+    const ArchiveEntry * pEntryArr;
+    uint                 entryCount;
+#ifdef _WIN32
+    void *               hFile;
+    void *               hMapping;
+#endif // _WIN32
+} Archive;
+
+// Archive being appended to
+typedef struct
+{
+    FILE *         pFile;
+    uint64_t       offset;           // End of the last record
+    ArchiveEntry * pEntryArr;
+    uint           entryCount;
+    uint           entryCapacity;
+    uchar *        pBuffer;          // Encoding scratch
+    size_t         bufferCapacity;
+} ArchiveWriter;
+
+// Reading functions
+BOOL ArchiveOpen(Archive * pArchive, const char * pPath);
+void ArchiveClose(Archive * pArchive);
+const ArchiveEntry * ArchiveFindGame(const Archive * pArchive, const uint gameId);
+BOOL ArchiveReadReplay(const Archive * pArchive, const ArchiveEntry * pEntry, Replay * pReplay);
+
+// Writing functions
+BOOL ArchiveWriterOpen(ArchiveWriter * pWriter, const char * pPath);
+BOOL ArchiveWriterAppend(ArchiveWriter * pWriter, const Replay * pReplay);
+BOOL ArchiveWriterClose(ArchiveWriter * pWriter);
+
+#endif // !ARCHIVE_H
@@ -0,0 +1,767 @@
+// snake-bench: headless engine throughput
+//
+// Plays seeded games with the game's own board, snake and simulation
+// modules, built with ENGINE_THREAD_LOCAL so that every thread runs its own
+// engine, and reports throughput, tick latency, peak memory and allocations.
+// Game g always uses seed + g, so the totals do not depend on the thread count.
+//
+// Allocations are counted by wrapping malloc() and friends at link time
+// (-Wl,--wrap=malloc,...), so only calls made by the engine and this file count
+
+// Needed for clock_gettime() and getrusage() with -std=c99
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/resource.h>
+
+#include "board.h"
+#include "globals.h"
+#include "snake.h"
+#include "snakering.h"
+#include "snapshot.h"
+#include "simulation.h"
+
+// Every LATENCY_SAMPLE-th tick is timed
+#define LATENCY_SAMPLE 8
+
+// Failed checks printed before only counting them
+#define MAX_REPORTED_FAILURES 10
+
+// Default tick limit of a game checked with --verify-safe-moves
+#define VERIFY_MAX_TICKS 600
+
+// Latency histogram, in nanoseconds
+// Values below HISTOGRAM_EXACT have a bucket each, larger values
+// HISTOGRAM_SUB buckets per power of two (under 2% error)
+#define HISTOGRAM_EXACT   128
+#define HISTOGRAM_SUB     64
+#define HISTOGRAM_BUCKETS (HISTOGRAM_EXACT + (34 * HISTOGRAM_SUB))
+
+typedef enum
+{
+    cControllerBuiltin = 0,  // Safe move closest to the food
+    cControllerRandom  = 1,  // Random safe move
+} Controller;
+
+typedef struct
+{
+    uint       gameCount;
+    ushort     width;
+    ushort     height;
+    uint       threadCount;
+    Controller controller;
+    uint       seed;
+    uint       maxTicks;     // Per game, 0 for width * height * 20
+    BOOL       isWrapping;
+    BOOL       isJson;
+    BOOL       isVerifyingRing;
+    BOOL       isVerifyingSafeMoves;
+} BenchOptions;
+
+// Totals of one thread, summed into the report
+typedef struct
+{
+    const BenchOptions * pOptions;
+    uint               threadIndex;
+    unsigned long long tickCount;
+    unsigned long long gameCount;
+    unsigned long long victoryCount;
+    unsigned long long cappedCount;
+    unsigned long long scoreTotal;
+    unsigned long long allocCount;
+    unsigned long long freeCount;
+    unsigned long long sampleCount;
+    unsigned long long latencyMax;
+    unsigned long long histogramArr[HISTOGRAM_BUCKETS];
+} BenchResult;
+
+static const Direction DIRECTION_ARR[4] = { cDirectionUp, cDirectionDown, cDirectionLeft, cDirectionRight };
+
+// Allocation counters of the calling thread
+static __thread unsigned long long allocCount;
+static __thread unsigned long long freeCount;
+
+// Allocator wrappers, see -Wl,--wrap in makefile_unix
+void * __real_malloc(size_t size);
+void * __real_calloc(size_t count, size_t size);
+void * __real_realloc(void * pMemory, size_t size);
+void __real_free(void * pMemory);
+
+void * __wrap_malloc(size_t size)
+{
+    allocCount++;
+    return __real_malloc(size);
+}
+
+void * __wrap_calloc(size_t count, size_t size)
+{
+    allocCount++;
+    return __real_calloc(count, size);
+}
+
+void * __wrap_realloc(void * pMemory, size_t size)
+{
+    allocCount++;
+    return __real_realloc(pMemory, size);
+}
+
+void __wrap_free(void * pMemory)
+{
+    freeCount += (pMemory != NULL);
+    __real_free(pMemory);
+}
+
+// Internal functions
+
+static unsigned long long NowNanoseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((unsigned long long)now.tv_sec * 1000000000ull) + (unsigned long long)now.tv_nsec;
+}
+
+// Return the histogram bucket of a latency
+static uint BucketOf(const unsigned long long nanoseconds)
+{
+    if(nanoseconds < HISTOGRAM_EXACT)
+    {
+        return (uint)nanoseconds;
+    }
+    uint exponent = 0;
+    while((nanoseconds >> exponent) >= 2 * HISTOGRAM_SUB)
+    {
+        exponent++;
+    }
+    const uint BUCKET = HISTOGRAM_EXACT + ((exponent - 1) * HISTOGRAM_SUB) + (uint)((nanoseconds >> exponent) - HISTOGRAM_SUB);
+    return (BUCKET < HISTOGRAM_BUCKETS) ? BUCKET : HISTOGRAM_BUCKETS - 1;
+}
+
+// Return the smallest latency of a histogram bucket
+static unsigned long long BucketValue(const uint bucket)
+{
+    if(bucket < HISTOGRAM_EXACT)
+    {
+        return bucket;
+    }
+    const uint EXPONENT = ((bucket - HISTOGRAM_EXACT) / HISTOGRAM_SUB) + 1;
+    return (unsigned long long)(HISTOGRAM_SUB + ((bucket - HISTOGRAM_EXACT) % HISTOGRAM_SUB)) << EXPONENT;
+}
+
+// Return the latency below which 'fraction' of the samples fall
+static unsigned long long Percentile(const BenchResult * pResult, const double fraction)
+{
+    const unsigned long long RANK = (unsigned long long)(fraction * (double)pResult->sampleCount);
+    unsigned long long seen = 0;
+    for(uint bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+    {
+        seen += pResult->histogramArr[bucket];
+        if(seen > RANK)
+        {
+            return BucketValue(bucket);
+        }
+    }
+    return pResult->latencyMax;
+}
+
+// Return TRUE if the direction would turn the snake back on itself
+// (the skipped enum value puts opposite directions 1 apart)
+static inline BOOL IsReverse(const Direction direction, const Direction current)
+{
+    return abs((int)direction - (int)current) == 1;
+}
+
+// Return the next direction of the built-in controller:
+// the safe move that ends closest to the food
+static Direction BuiltinController(void)
+{
+    const uchar SAFE_MOVES = SimulationGetSafeMoves();
+    const Direction CURRENT = SnakeGetDirection();
+    const Point HEAD = BoardToPoint(SnakeGetHead()->index);
+    const Point FOOD = BoardGetFood();
+
+    Direction best = CURRENT;
+    int bestDistance = -1;
+    for(uint i = 0; i < 4; i++)
+    {
+        const Direction DIRECTION = DIRECTION_ARR[i];
+        if(IsReverse(DIRECTION, CURRENT) || !(SAFE_MOVES & SimulationMoveBit(DIRECTION)))
+        {
+            continue;
+        }
+        const int X = HEAD.x + ((DIRECTION == cDirectionRight) - (DIRECTION == cDirectionLeft));
+        const int Y = HEAD.y + ((DIRECTION == cDirectionDown) - (DIRECTION == cDirectionUp));
+        const int DISTANCE = abs(FOOD.x - X) + abs(FOOD.y - Y);
+        if(bestDistance < 0 || DISTANCE < bestDistance)
+        {
+            best = DIRECTION;
+            bestDistance = DISTANCE;
+        }
+    }
+    return best;
+}
+
+// Return the next pseudo-random number (xorshift32)
+static uint NextRandom(uint * pRandom)
+{
+    *pRandom ^= *pRandom << 13;
+    *pRandom ^= *pRandom >> 17;
+    *pRandom ^= *pRandom << 5;
+    return *pRandom;
+}
+
+// Return a random safe direction, or the current one if none is safe
+static Direction RandomController(uint * pRandom)
+{
+    const uchar SAFE_MOVES = SimulationGetSafeMoves();
+    const Direction CURRENT = SnakeGetDirection();
+
+    NextRandom(pRandom);
+    for(uint i = 0; i < 4; i++)
+    {
+        const Direction DIRECTION = DIRECTION_ARR[(*pRandom + i) % 4];
+        if(!IsReverse(DIRECTION, CURRENT) && (SAFE_MOVES & SimulationMoveBit(DIRECTION)))
+        {
+            return DIRECTION;
+        }
+    }
+    return CURRENT;
+}
+
+// Play one game, timing every LATENCY_SAMPLE-th tick
+static void PlayGame(BenchResult * pResult, const uint seed, const uint maxTicks)
+{
+    const BenchOptions * pOptions = pResult->pOptions;
+    uint random = seed | 1;
+    SimulationReset(pOptions->width, pOptions->height, seed);
+
+    TickResult result = cTickMoved;
+    uint tick = 0;
+    while(result != cTickDefeat && result != cTickVictory && tick < maxTicks)
+    {
+        SnakeSetDirection((pOptions->controller == cControllerRandom) ? RandomController(&random) : BuiltinController());
+        if(tick % LATENCY_SAMPLE == 0)
+        {
+            const unsigned long long START = NowNanoseconds();
+            result = SimulationTick();
+            const unsigned long long LATENCY = NowNanoseconds() - START;
+            pResult->histogramArr[BucketOf(LATENCY)]++;
+            pResult->latencyMax = (LATENCY > pResult->latencyMax) ? LATENCY : pResult->latencyMax;
+            pResult->sampleCount++;
+        }
+        else
+        {
+            result = SimulationTick();
+        }
+        tick++;
+    }
+
+    pResult->tickCount    += tick;
+    pResult->gameCount++;
+    pResult->victoryCount += (result == cTickVictory);
+    pResult->cappedCount  += (result != cTickDefeat && result != cTickVictory);
+    pResult->scoreTotal   += SimulationGetScore();
+}
+
+// Thread entry: play every game g with g % threadCount == threadIndex
+static void * BenchThreadMain(void * pData)
+{
+    BenchResult * pResult = (BenchResult *)pData;
+    const BenchOptions * pOptions = pResult->pOptions;
+    const uint MAX_TICKS = (pOptions->maxTicks > 0) ? pOptions->maxTicks : (uint)pOptions->width * pOptions->height * 20;
+
+    allocCount = 0;
+    freeCount = 0;
+    SimulationSetWrapping(pOptions->isWrapping);
+    for(uint game = pResult->threadIndex; game < pOptions->gameCount; game += pOptions->threadCount)
+    {
+        PlayGame(pResult, pOptions->seed + game, MAX_TICKS);
+    }
+    SimulationFree();
+    pResult->allocCount = allocCount;
+    pResult->freeCount  = freeCount;
+    return NULL;
+}
+
+// Add the totals of one thread to another
+static void AddResult(BenchResult * pTotal, const BenchResult * pResult)
+{
+    pTotal->tickCount    += pResult->tickCount;
+    pTotal->gameCount    += pResult->gameCount;
+    pTotal->victoryCount += pResult->victoryCount;
+    pTotal->cappedCount  += pResult->cappedCount;
+    pTotal->scoreTotal   += pResult->scoreTotal;
+    pTotal->allocCount   += pResult->allocCount;
+    pTotal->freeCount    += pResult->freeCount;
+    pTotal->sampleCount  += pResult->sampleCount;
+    pTotal->latencyMax    = (pResult->latencyMax > pTotal->latencyMax) ? pResult->latencyMax : pTotal->latencyMax;
+    for(uint bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+    {
+        pTotal->histogramArr[bucket] += pResult->histogramArr[bucket];
+    }
+}
+
+static void PrintReport(const BenchOptions * pOptions, const BenchResult * pTotal, const double seconds, const long peakKilobytes)
+{
+    const char * pController = (pOptions->controller == cControllerRandom) ? "random" : "builtin";
+    const double TICKS_PER_SECOND = (seconds > 0.0) ? pTotal->tickCount / seconds : 0.0;
+    const double GAMES_PER_SECOND = (seconds > 0.0) ? pTotal->gameCount / seconds : 0.0;
+    const double ALLOCS_PER_TICK  = (pTotal->tickCount > 0) ? (double)pTotal->allocCount / pTotal->tickCount : 0.0;
+    const double MEAN_SCORE       = (pTotal->gameCount > 0) ? (double)pTotal->scoreTotal / pTotal->gameCount : 0.0;
+
+    if(pOptions->isJson)
+    {
+        printf("{\"games\": %llu, \"width\": %u, \"height\": %u, \"wrap\": %s, \"threads\": %u, \"controller\": \"%s\", \"seed\": %u,\n",
+               pTotal->gameCount, pOptions->width, pOptions->height, (pOptions->isWrapping) ? "true" : "false",
+               pOptions->threadCount, pController, pOptions->seed);
+        printf(" \"ticks\": %llu, \"seconds\": %.6f, \"ticks_per_sec\": %.0f, \"games_per_sec\": %.1f,\n",
+               pTotal->tickCount, seconds, TICKS_PER_SECOND, GAMES_PER_SECOND);
+        printf(" \"tick_ns\": {\"p50\": %llu, \"p90\": %llu, \"p99\": %llu, \"p999\": %llu, \"max\": %llu, \"samples\": %llu},\n",
+               Percentile(pTotal, 0.5), Percentile(pTotal, 0.9), Percentile(pTotal, 0.99), Percentile(pTotal, 0.999), pTotal->latencyMax, pTotal->sampleCount);
+        printf(" \"peak_rss_kb\": %ld, \"allocations\": %llu, \"frees\": %llu, \"allocations_per_tick\": %.3f,\n",
+               peakKilobytes, pTotal->allocCount, pTotal->freeCount, ALLOCS_PER_TICK);
+        printf(" \"victories\": %llu, \"capped\": %llu, \"score_total\": %llu}\n",
+               pTotal->victoryCount, pTotal->cappedCount, pTotal->scoreTotal);
+        return;
+    }
+
+    printf("snake-bench: %llu games on %ux%u%s, %u thread%s, %s controller, seed %u\n",
+           pTotal->gameCount, pOptions->width, pOptions->height, (pOptions->isWrapping) ? " (wrapping)" : "", pOptions->threadCount, (pOptions->threadCount == 1) ? "" : "s", pController, pOptions->seed);
+    printf("ticks:        %llu in %.3f s\n", pTotal->tickCount, seconds);
+    printf("throughput:   %.0f ticks/sec, %.1f games/sec\n", TICKS_PER_SECOND, GAMES_PER_SECOND);
+    printf("tick latency: p50 %llu ns, p90 %llu ns, p99 %llu ns, p99.9 %llu ns, max %llu ns (1 in %d ticks timed)\n",
+           Percentile(pTotal, 0.5), Percentile(pTotal, 0.9), Percentile(pTotal, 0.99), Percentile(pTotal, 0.999), pTotal->latencyMax, LATENCY_SAMPLE);
+    printf("memory:       peak RSS %ld KB, %llu allocations (%.3f per tick), %llu frees\n",
+           peakKilobytes, pTotal->allocCount, ALLOCS_PER_TICK, pTotal->freeCount);
+    printf("games:        %llu victories, %llu capped at the tick limit, mean score %.1f\n",
+           pTotal->victoryCount, pTotal->cappedCount, MEAN_SCORE);
+}
+
+// Checks
+// Games are steered at random, turning on about one tick in four, so the
+// snake keeps running into walls and itself and many ticks only warn
+
+// Return the next direction of a wandering snake
+static Direction WanderController(uint * pRandom)
+{
+    const uint RANDOM = NextRandom(pRandom);
+    return ((RANDOM >> 8) % 4 == 0) ? DIRECTION_ARR[RANDOM % 4] : SnakeGetQueuedDirection();
+}
+
+// Return TRUE if a snapshot holds the live board and snake
+static BOOL IsSnapshotLive(const Snapshot * pSnapshot)
+{
+    const uchar * pCell = pSnapshot->pCellArr;
+    for(int y = -1; y <= pSnapshot->height; y++)
+    {
+        for(int x = -1; x <= pSnapshot->width; x++)
+        {
+            if(*pCell++ != (uchar)BoardGetCell((Point){x, y}))
+            {
+                return FALSE;
+            }
+        }
+    }
+    uint i = 0;
+    for(const SnakePart * pCurrent = SnakeGetHead(); pCurrent; pCurrent = pCurrent->pNext, i++)
+    {
+        if(i >= pSnapshot->length || !PointsAreEqual(pSnapshot->pBodyArr[i], BoardToPoint(pCurrent->index)))
+        {
+            return FALSE;
+        }
+    }
+    return i == pSnapshot->length;
+}
+
+// Follow a snapshot taken 'ticks' after the ring's as the cached, mesh and
+// grid renderers do (see SnakeCacheDraw()), and check the result
+// Those renderers clear the cells of the popped tail parts and then redraw
+// the new heads, the old head and the tail, so a popped cell must not hold
+// any other part. The ring must then hold the whole body
+// Return FALSE if the check fails, *pIsRebuilt tells if the ring was assigned
+static BOOL FollowRing(SnakeRing * pRing, const Snapshot * pSnapshot, const uint ticks, BOOL * pIsRebuilt)
+{
+    const uint LENGTH = pSnapshot->length;
+    *pIsRebuilt = TRUE;
+    if(!SnakeRingCanFollow(pRing, pSnapshot, ticks))
+    {
+        SnakeRingAssign(pRing, pSnapshot);
+        return TRUE;
+    }
+    const uint MOVES = SnakeRingCountMoves(pRing, pSnapshot, ticks);
+    if(MOVES > ticks)
+    {
+        SnakeRingAssign(pRing, pSnapshot);
+        return TRUE;
+    }
+
+    const uint TAIL_START = SnakeRingTailStart(pSnapshot);
+    SnakeRingPushHeads(pRing, pSnapshot, MOVES);
+    while(SnakeRingHasStaleTail(pRing, pSnapshot, MOVES))
+    {
+        const Point POPPED = SnakeRingPopTail(pRing);
+        for(uint i = MOVES + 1; i < TAIL_START; i++)
+        {
+            if(PointsAreEqual(pSnapshot->pBodyArr[i], POPPED))
+            {
+                return FALSE;
+            }
+        }
+    }
+    SnakeRingPushGrownTail(pRing, pSnapshot);
+    if(!SnakeRingMatches(pRing, pSnapshot))
+    {
+        SnakeRingAssign(pRing, pSnapshot);
+        return TRUE;
+    }
+    *pIsRebuilt = FALSE;
+    for(uint i = 0; i < LENGTH; i++)
+    {
+        if(!PointsAreEqual(SnakeRingAt(pRing, i)->point, pSnapshot->pBodyArr[i]))
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+// Publish snapshots into three slots, as the simulation thread does, and
+// follow some of them with a ring, as the renderers do
+// Every published snapshot must hold the live state and every followed
+// one must leave the ring in step with the body
+// Return the number of failed checks
+static uint VerifyRing(const BenchOptions * pOptions)
+{
+    Snapshot snapshotArr[3];
+    SnakeRing ring;
+    BOOL isAllocated = SnakeRingInitialise(&ring, pOptions->width, pOptions->height);
+    for(uint i = 0; i < 3; i++)
+    {
+        isAllocated = SnapshotInitialise(&snapshotArr[i], pOptions->width, pOptions->height) && isAllocated;
+    }
+    if(!isAllocated)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    unsigned long long publishCount = 0;
+    unsigned long long followCount = 0;
+    unsigned long long rebuildCount = 0;
+    unsigned long long warningCount = 0;
+    uint failureCount = 0;
+    uint random = pOptions->seed | 1;
+    SimulationSetWrapping(pOptions->isWrapping);
+    for(uint game = 0; game < pOptions->gameCount; game++)
+    {
+        const uint SEED = pOptions->seed + game;
+        SimulationReset(pOptions->width, pOptions->height, SEED);
+        uint slot = 0;
+        uint ringTick = 0;
+        BOOL isFollowing = FALSE;
+        TickResult result = cTickMoved;
+        for(uint tick = 0; result != cTickDefeat && result != cTickVictory && tick < pOptions->maxTicks; tick++)
+        {
+            SnakeSetDirection(WanderController(&random));
+            result = SimulationTick();
+            warningCount += (result == cTickWarning);
+
+            // Some ticks are not published and some snapshots not drawn
+            const uint SCHEDULE = NextRandom(&random);
+            if(SCHEDULE % 4 == 0)
+            {
+                continue;
+            }
+
+            Snapshot * pSnapshot = &snapshotArr[slot];
+            SnapshotCapture(pSnapshot, SEED, result);
+            slot = (slot + 1) % 3;
+            publishCount++;
+            if(!IsSnapshotLive(pSnapshot))
+            {
+                if(failureCount < MAX_REPORTED_FAILURES)
+                {
+                    printf("Snapshot out of step at tick %u of seed %u\n", tick, SEED);
+                }
+                failureCount++;
+                break;
+            }
+            if((SCHEDULE >> 4) % 2 == 0)
+            {
+                continue;
+            }
+
+            BOOL isRebuilt = TRUE;
+            if(!isFollowing)
+            {
+                SnakeRingAssign(&ring, pSnapshot);
+            }
+            else if(!FollowRing(&ring, pSnapshot, pSnapshot->tickCount - ringTick, &isRebuilt))
+            {
+                if(failureCount < MAX_REPORTED_FAILURES)
+                {
+                    printf("Ring out of step at tick %u of seed %u\n", tick, SEED);
+                }
+                failureCount++;
+                break;
+            }
+            ringTick = pSnapshot->tickCount;
+            isFollowing = TRUE;
+            followCount++;
+            rebuildCount += isRebuilt;
+        }
+    }
+
+    printf("verify-ring: %u games on %ux%u%s, %llu warning ticks, %llu snapshots, %llu followed, %llu rebuilt, %u failures\n",
+           pOptions->gameCount, pOptions->width, pOptions->height, (pOptions->isWrapping) ? " (wrapping)" : "",
+           warningCount, publishCount, followCount, rebuildCount, failureCount);
+    for(uint i = 0; i < 3; i++)
+    {
+        SnapshotFree(&snapshotArr[i]);
+    }
+    SnakeRingFree(&ring);
+    SimulationFree();
+    return failureCount;
+}
+
+// Play a game from the start up to (not including) tick 'tickCount'
+static void Rewind(const BenchOptions * pOptions, const uint seed, const Direction * pInputArr, const uint tickCount)
+{
+    SimulationReset(pOptions->width, pOptions->height, seed);
+    for(uint tick = 0; tick < tickCount; tick++)
+    {
+        SnakeSetDirection(pInputArr[tick]);
+        SimulationTick();
+    }
+}
+
+// Compare the safe-move mask before every tick with what ticking in each
+// of the four directions does: a direction's bit must be set exactly when
+// the tick moves the snake, not when it only warns or ends the game
+// The engine cannot be copied, so the game is played again from the start
+// for every direction that is tried and not kept. Even games wander, odd
+// ones follow the built-in controller and grow long
+// Return the number of failed checks
+static uint VerifySafeMoves(const BenchOptions * pOptions)
+{
+    Direction * pInputArr = (Direction *)malloc(pOptions->maxTicks * sizeof(Direction));
+    if(!pInputArr)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    unsigned long long tickCount = 0;
+    unsigned long long unsafeCount = 0;
+    uint failureCount = 0;
+    uint random = pOptions->seed | 1;
+    SimulationSetWrapping(pOptions->isWrapping);
+    for(uint game = 0; game < pOptions->gameCount; game++)
+    {
+        const uint SEED = pOptions->seed + game;
+        SimulationReset(pOptions->width, pOptions->height, SEED);
+        TickResult result = cTickMoved;
+        for(uint tick = 0; result != cTickDefeat && result != cTickVictory && tick < pOptions->maxTicks; tick++)
+        {
+            const uchar SAFE_MOVES = SimulationGetSafeMoves();
+            const Direction KEPT = (game % 2 == 0) ? WanderController(&random) : BuiltinController();
+
+            // The kept direction is tried last, so the game goes on from its tick
+            uint triedCount = 0;
+            for(uint i = 0; i < 5; i++)
+            {
+                const Direction DIRECTION = (i < 4) ? DIRECTION_ARR[i] : KEPT;
+                if(i < 4 && DIRECTION == KEPT)
+                {
+                    continue;
+                }
+                if(triedCount++ > 0)
+                {
+                    Rewind(pOptions, SEED, pInputArr, tick);
+                }
+                SnakeSetDirection(DIRECTION);
+                result = SimulationTick();
+
+                const BOOL IS_SAFE = (SAFE_MOVES & SimulationMoveBit(DIRECTION)) != 0;
+                const BOOL HAS_MOVED = result != cTickWarning && result != cTickDefeat;
+                unsafeCount += !HAS_MOVED;
+                if(IS_SAFE != HAS_MOVED)
+                {
+                    if(failureCount < MAX_REPORTED_FAILURES)
+                    {
+                        printf("Safe-move mask 0x%x disagrees with moving %d at tick %u of seed %u\n", SAFE_MOVES, DIRECTION, tick, SEED);
+                    }
+                    failureCount++;
+                }
+            }
+            pInputArr[tick] = KEPT;
+            tickCount++;
+        }
+    }
+
+    printf("verify-safe-moves: %u games on %ux%u%s, %d-bit cells, %llu ticks, %llu directions tried, %llu unsafe, %u failures\n",
+           pOptions->gameCount, pOptions->width, pOptions->height, (pOptions->isWrapping) ? " (wrapping)" : "",
+           BOARD_CELL_BITS, tickCount, tickCount * 4, unsafeCount, failureCount);
+    free(pInputArr);
+    SimulationFree();
+    return failureCount;
+}
+
+int main(int argc, char * argv[])
+{
+    // Command line options
+    // --games <n>          number of games (default 1000)
+    // --size <w>x<h>       board size (default 40x30)
+    // --threads <n>        worker threads (default 1)
+    // --controller <builtin|random> how the snake is steered (default builtin)
+    // --seed <n>           seed of the first game (default 1)
+    // --max-ticks <n>      end a game after n ticks (default 20 per cell)
+    // --wrap               the snake wraps around the board edges instead of hitting walls
+    // --json               print the report as JSON
+    // --verify-ring        check that snapshots and the renderers' body rings
+    //                      stay in step with the game, exit with -1 if not
+    // --verify-safe-moves  check the safe-move mask against ticking in every
+    //                      direction, exit with -1 if they disagree
+    BenchOptions options;
+    options.gameCount   = 1000;
+    options.width       = 40;
+    options.height      = 30;
+    options.threadCount = 1;
+    options.controller  = cControllerBuiltin;
+    options.seed        = 1;
+    options.maxTicks    = 0;
+    options.isWrapping  = FALSE;
+    options.isJson      = FALSE;
+    options.isVerifyingRing = FALSE;
+    options.isVerifyingSafeMoves = FALSE;
+    for(int i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+        {
+            options.gameCount = (uint)strtoul(argv[++i], NULL, 10);
+        }
+        else if(strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+        {
+            uint width = 0;
+            uint height = 0;
+            if(sscanf(argv[++i], "%ux%u", &width, &height) != 2 || width < 4 || height < 1 || width > MAX_BOARD_SIZE || height > MAX_BOARD_SIZE)
+            {
+                printf("Invalid board size: %s\n", argv[i]);
+                return -1;
+            }
+            options.width  = (ushort)width;
+            options.height = (ushort)height;
+        }
+        else if(strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+        {
+            options.threadCount = (uint)strtoul(argv[++i], NULL, 10);
+        }
+        else if(strcmp(argv[i], "--controller") == 0 && i + 1 < argc)
+        {
+            i++;
+            options.controller = (strcmp(argv[i], "random") == 0) ? cControllerRandom : cControllerBuiltin;
+        }
+        else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            options.seed = (uint)strtoul(argv[++i], NULL, 10);
+        }
+        else if(strcmp(argv[i], "--max-ticks") == 0 && i + 1 < argc)
+        {
+            options.maxTicks = (uint)strtoul(argv[++i], NULL, 10);
+        }
+        else if(strcmp(argv[i], "--wrap") == 0)
+        {
+            options.isWrapping = TRUE;
+        }
+        else if(strcmp(argv[i], "--json") == 0)
+        {
+            options.isJson = TRUE;
+        }
+        else if(strcmp(argv[i], "--verify-ring") == 0)
+        {
+            options.isVerifyingRing = TRUE;
+        }
+        else if(strcmp(argv[i], "--verify-safe-moves") == 0)
+        {
+            options.isVerifyingSafeMoves = TRUE;
+        }
+        else
+        {
+            printf("Unknown option: %s\n", argv[i]);
+            return -1;
+        }
+    }
+    if(options.isVerifyingRing || options.isVerifyingSafeMoves)
+    {
+        // Every tick of a game is played again for the safe moves
+        if(options.maxTicks == 0)
+        {
+            options.maxTicks = (options.isVerifyingSafeMoves) ? VERIFY_MAX_TICKS : (uint)options.width * options.height * 20;
+        }
+        uint failureCount = 0;
+        if(options.isVerifyingRing)
+        {
+            failureCount += VerifyRing(&options);
+        }
+        if(options.isVerifyingSafeMoves)
+        {
+            failureCount += VerifySafeMoves(&options);
+        }
+        return (failureCount == 0) ? 0 : -1;
+    }
+    if(options.threadCount == 0)
+    {
+        options.threadCount = 1;
+    }
+    if(options.threadCount > options.gameCount && options.gameCount > 0)
+    {
+        options.threadCount = options.gameCount;
+    }
+
+    BenchResult * pResultArr = (BenchResult *)calloc(options.threadCount, sizeof(BenchResult));
+    pthread_t * pThreadArr = (pthread_t *)calloc(options.threadCount, sizeof(pthread_t));
+    if(!pResultArr || !pThreadArr)
+    {
+        printf("Out of memory\n");
+        return -1;
+    }
+
+    const unsigned long long START = NowNanoseconds();
+    for(uint t = 0; t < options.threadCount; t++)
+    {
+        pResultArr[t].pOptions    = &options;
+        pResultArr[t].threadIndex = t;
+        if(pthread_create(&pThreadArr[t], NULL, BenchThreadMain, &pResultArr[t]) != 0)
+        {
+            printf("Cannot start thread %u\n", t);
+            return -1;
+        }
+    }
+    for(uint t = 0; t < options.threadCount; t++)
+    {
+        pthread_join(pThreadArr[t], NULL);
+    }
+    const double SECONDS = (double)(NowNanoseconds() - START) / 1e9;
+
+    BenchResult * pTotal = (BenchResult *)calloc(1, sizeof(BenchResult));
+    for(uint t = 0; t < options.threadCount && pTotal; t++)
+    {
+        AddResult(pTotal, &pResultArr[t]);
+    }
+
+    // Linux reports the peak resident set size in kilobytes
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    if(pTotal)
+    {
+        PrintReport(&options, pTotal, SECONDS, usage.ru_maxrss);
+    }
+
+    free(pTotal);
+    free(pThreadArr);
+    free(pResultArr);
+    return 0;
+}
@@ -1,145 +1,326 @@
 #include "board.h"
 
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "globals.h"
+#include "trace.h"
+#ifndef HEADLESS
+#include "camera.h"
 #include "renderer.h"
+#endif // !HEADLESS
+
+// Cell storage
+// Cells are CELL_BITS wide, several to a byte in the packed mode.
+// The board is surrounded by walls: a wall row above and below it, and
+// every row is padded with walls to a power of two cells (at least one
+// 64-bit word, so reset and the free-cell scan work on whole words).
+// Stepping off the board in any direction lands on a wall inside the
+// array, so a cell next to a board cell can be read without range checks.
+// Index 0 is the first cell of the top wall row.
+// On a wrapping board the wall cells a step off the board are mapped to
+// the board cell on the opposite edge (see BoardGetWrapTable()). Rows then
+// have at least two padding cells, so stepping left off one row and right
+// off the row above never land on the same wall cell
+#define CELL_BITS      BOARD_CELL_BITS
+#define CELL_MASK      ((1u << CELL_BITS) - 1)
+#define CELLS_PER_BYTE (8 / CELL_BITS)
+#define CELLS_PER_WORD (64 / CELL_BITS)
+#define WORD_SIZE      sizeof(uint64_t)
+
+// Lowest bit of every cell in a word (0x0101... or 0x5555...)
+#define CELL_LOW_BITS  (UINT64_MAX / CELL_MASK)
 
 // Internal variables
-static Celltype cellArr[BOARD_WIDTH * BOARD_HEIGHT] = { cTypeFree };
-static Point freeCellArr[BOARD_WIDTH * BOARD_HEIGHT] = { 0 };
-static uchar rainbowTick;
+ENGINE_STATE uchar * cellArr = NULL;
+ENGINE_STATE uchar * pRowTemplate;  // Board row after a reset, stored after the bottom wall row
+ENGINE_STATE uint rowStride;
+ENGINE_STATE uint rowCells;
+ENGINE_STATE uint * pWrapArr;       // Only allocated on a wrapping board
+ENGINE_STATE uint rowShift;         // log2(rowCells)
+ENGINE_STATE uint rowWords;         // Words of a row that hold board cells
+ENGINE_STATE uint cellCount;
+ENGINE_STATE ushort boardWidth;
+ENGINE_STATE ushort boardHeight;
+#ifndef HEADLESS
+static uchar rainbowTick;  // Only used for drawing
+#endif // !HEADLESS
+ENGINE_STATE uint rngState;
+ENGINE_STATE Point foodPoint;
 
 // Internal functions
 
+// Return the next pseudo-random number (xorshift32)
+// Food placement must only depend on the seed so that
+// replays are identical on every platform and C library
+static inline uint NextRandom(void)
+{
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+// Return the number of set bits
+static inline uint PopCount(uint64_t x)
+{
+#ifdef __POPCNT__
+    return (uint)__builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (uint)((x * 0x0101010101010101ull) >> 56);
+#endif // __POPCNT__
+}
+
 // Return TRUE if point is within board bounds
 // Otherwise, return FALSE
 static inline BOOL IsPointInBounds(const Point point)
 {
-    return (-1 < point.x && point.x < BOARD_WIDTH)
-        && (-1 < point.y && point.y < BOARD_HEIGHT);
+    return ((uint)point.x < boardWidth) & ((uint)point.y < boardHeight);
 }
 
-// Convert the point to an array index
-static inline short ToIndex(const Point point)
+// Convert the point to a cell index (rows are 'rowCells' apart)
+static inline uint ToIndex(const Point point)
 {
-    return (point.y * BOARD_WIDTH) + point.x;
+    return ((uint)(point.y + 1) << rowShift) + (uint)point.x;
+}
+
+// Read the cell at the index
+static inline uint ReadCell(const uint index)
+{
+    return BoardReadCellFrom(cellArr, index);
+}
+
+// Write the cell at the index of 'pCells'
+static inline void WriteCell(uchar * pCells, const uint index, const uint cell)
+{
+    const uint SHIFT = (index % CELLS_PER_BYTE) * CELL_BITS;
+    uchar * pByte = &pCells[index / CELLS_PER_BYTE];
+    *pByte = (uchar)((*pByte & ~(CELL_MASK << SHIFT)) | (cell << SHIFT));
+}
+
+// Load one word of cells
+// memcpy keeps this legal for any alignment and compiles to a single load
+static inline uint64_t ReadWord(const uchar * pBytes)
+{
+    uint64_t word;
+    memcpy(&word, pBytes, WORD_SIZE);
+    return word;
+}
+
+// Return the number of free cells in a word
+// Cell values fit in two bits, so a cell is taken if either of its
+// two lowest bits is set
+static inline uint CountFreeInWord(const uint64_t word)
+{
+    return CELLS_PER_WORD - PopCount((word | (word >> 1)) & CELL_LOW_BITS);
 }
 
-// Find all free cells and populate 'freeCellArr'
-// with their points starting at index 0
-//
 // Return number of free cells
-static uint BoardGetFreeCells(void)
+// Only the words holding board cells are read, the wall rows
+// and the words of padding after them have no free cells
+static uint BoardCountFreeCells(void)
 {
     uint count = 0;
-    for(ushort x = 0; x < BOARD_WIDTH; x++)
+    for(uint y = 1; y <= boardHeight; y++)
     {
-        for(ushort y = 0; y < BOARD_HEIGHT; y++)
+        const uchar * pRow = cellArr + ((size_t)y * rowStride);
+        for(uint w = 0; w < rowWords; w++)
         {
-            const short INDEX = ToIndex((Point){x, y});
-            if(cellArr[INDEX] == cTypeFree)
+            count += CountFreeInWord(ReadWord(pRow + (w * WORD_SIZE)));
+        }
+    }
+    return count;
+}
+
+// Fill the wrap table
+// Every index maps to itself, except the wall cells a step off the board
+static void BuildWrapTable(void)
+{
+    for(uint index = 0; index < cellCount; index++)
+    {
+        pWrapArr[index] = index;
+    }
+    for(ushort x = 0; x < boardWidth; x++)
+    {
+        pWrapArr[ToIndex((Point){x, -1})]          = ToIndex((Point){x, boardHeight - 1});
+        pWrapArr[ToIndex((Point){x, boardHeight})] = ToIndex((Point){x, 0});
+    }
+    for(ushort y = 0; y < boardHeight; y++)
+    {
+        pWrapArr[ToIndex((Point){0, y}) - 1]              = ToIndex((Point){boardWidth - 1, y});
+        pWrapArr[ToIndex((Point){boardWidth - 1, y}) + 1] = ToIndex((Point){0, y});
+    }
+}
+
+// Find the n-th free cell in row-major order
+// Whole words are skipped until the one that holds it
+static Point BoardFindFreeCell(uint n)
+{
+    for(uint y = 1; y <= boardHeight; y++)
+    {
+        for(uint w = 0; w < rowWords; w++)
+        {
+            const uint INDEX = (y << rowShift) + (w * CELLS_PER_WORD);
+            const uint FREE_COUNT = CountFreeInWord(ReadWord(cellArr + (INDEX / CELLS_PER_BYTE)));
+            if(n >= FREE_COUNT)
+            {
+                n -= FREE_COUNT;
+                continue;
+            }
+            for(uint index = INDEX; ; index++)
             {
-                freeCellArr[count].x = x;
-                freeCellArr[count++].y = y;
+                if(ReadCell(index) == cTypeFree && n-- == 0)
+                {
+                    return BoardToPoint(index);
+                }
             }
         }
     }
-    return count;
+    return (Point){-1, -1};
 }
 
 // Public functions
 
 // "Constructor"
-// Reset the array elements to 0
-void BoardInitialise(void)
+// Allocate the cell array and reset the cells to 'free'
+// The array is kept if the size and wrapping have not changed, so
+// pointers returned by BoardGetCells() stay valid across resets
+// Return FALSE if the board is too large or out of memory, the board
+// is then left without cells
+BOOL BoardInitialise(const ushort width, const ushort height, const BOOL isWrapping)
 {
-    memset(cellArr, cTypeFree, sizeof(cellArr));
-    memset(freeCellArr, 0, sizeof(cellArr));
-    rainbowTick = 0;
+    if(!cellArr || width != boardWidth || height != boardHeight || isWrapping != (pWrapArr != NULL))
+    {
+        BoardFree();
+        const uint PADDING = (isWrapping) ? 2 : 1;
+        rowShift = 0;
+        while((1u << rowShift) < CELLS_PER_WORD || (1u << rowShift) < width + PADDING)
+        {
+            rowShift++;
+        }
+        rowCells = 1u << rowShift;
+
+        // Cell indices (and the template row after the bottom wall) must fit in a uint
+        if((uint64_t)rowCells * (height + 3) > UINT32_MAX)
+        {
+            BoardFree();
+            return FALSE;
+        }
+        rowStride    = rowCells / CELLS_PER_BYTE;
+        rowWords     = (width + CELLS_PER_WORD - 1) / CELLS_PER_WORD;
+        cellCount    = rowCells * (height + 2);
+        cellArr      = (uchar *)calloc((size_t)rowStride * (height + 3), 1);
+        if(!cellArr)
+        {
+            BoardFree();
+            return FALSE;
+        }
+        pRowTemplate = cellArr + ((size_t)rowStride * (height + 2));
+        boardWidth   = width;
+        boardHeight  = height;
+
+        // Wall rows, and the padding cells of the template row
+        for(uint x = 0; x < rowCells; x++)
+        {
+            WriteCell(cellArr, x, cTypeWall);
+            WriteCell(pRowTemplate, x, (x < width) ? cTypeFree : cTypeWall);
+        }
+        memcpy(cellArr + ((size_t)rowStride * (height + 1)), cellArr, rowStride);
+
+        if(isWrapping)
+        {
+            pWrapArr = (uint *)malloc((size_t)cellCount * sizeof(uint));
+            if(!pWrapArr)
+            {
+                BoardFree();
+                return FALSE;
+            }
+            BuildWrapTable();
+        }
+    }
+    for(ushort y = 1; y <= height; y++)
+    {
+        memcpy(cellArr + ((size_t)y * rowStride), pRowTemplate, rowStride);
+    }
+    foodPoint.x = -1;
+    foodPoint.y = -1;
+    return TRUE;
 }
 
 // "Destructor"
 void BoardFree(void)
 {
+    if(cellArr)
+    {
+        free(cellArr);
+        cellArr = NULL;
+    }
+    free(pWrapArr);
+    pWrapArr     = NULL;
+    pRowTemplate = NULL;
+    rowStride    = 0;
+    rowCells     = 0;
+    rowShift     = 0;
+    rowWords     = 0;
+    cellCount    = 0;
+    boardWidth   = 0;
+    boardHeight  = 0;
 }
 
-// Draw the board
+#ifndef HEADLESS
+// Draw the board from a snapshot
 //
 // if DEBUG draw the snake cells and grid
-void BoardDraw(void)
+void BoardDraw(const Snapshot * pSnapshot)
 {
-    SDL_Renderer * pRenderer = GetRenderer();
-    int windowWidth = 0;
-    int windowHeight = 0;
-    RendererGetWindowSize(&windowWidth, &windowHeight);
+    TRACE_BEGIN(BoardDraw);
+    const ushort WIDTH  = pSnapshot->width;
+    const ushort HEIGHT = pSnapshot->height;
 
-    const int OFFSET_X = (windowWidth / 2) - ((BOARD_WIDTH * CELL_SIZE) / 2);
-    const int OFFSET_Y = (windowHeight / 2) - ((BOARD_HEIGHT * CELL_SIZE) / 2);
-    const ushort CELL_PADDING = CELL_SIZE / 5;
+    // Only the cells in the window are drawn, see camera.h
+    int offsetX = 0;
+    int offsetY = 0;
+    int minX = 0;
+    int minY = 0;
+    int maxX = 0;
+    int maxY = 0;
+    CameraGetOffset(&offsetX, &offsetY);
+    CameraGetVisibleCells(&minX, &minY, &maxX, &maxY);
 
-    // Draw the border around the board
-    {
-        SDL_SetRenderDrawColor(pRenderer, 255, 255, 255, SDL_ALPHA_OPAQUE);
-        SDL_Rect r;
-        r.x = OFFSET_X - CELL_PADDING;
-        r.y = OFFSET_Y - CELL_PADDING;
-        r.w = (BOARD_WIDTH * CELL_SIZE) + (CELL_PADDING * 2);
-        r.h = (BOARD_HEIGHT * CELL_SIZE) + (CELL_PADDING * 2);
-        SDL_RenderFillRect(pRenderer, &r);
-    }
+    const int OFFSET_X = offsetX;
+    const int OFFSET_Y = offsetY;
+    const int CELL = CameraGetCellSize();
+    const int CELL_PADDING = CELL / 5;
 
-    for(ushort x = 0; x < BOARD_WIDTH; x++)
+    // Draw every visible cell, the wall border included
+    for(int x = minX; x <= maxX; x++)
     {
-        for(ushort y = 0; y < BOARD_HEIGHT; y++)
+        for(int y = minY; y <= maxY; y++)
         {
-            const Celltype CURRENT = BoardGetCell((Point){x, y});
+            const Celltype CURRENT = (Celltype)pSnapshot->pCellArr[((y + 1) * (WIDTH + 2)) + x + 1];
             if(CURRENT == cTypeWall)
             {
-                // TODO:
-                // This block is currently not used.
-                // Will have to be tested
-                SDL_SetRenderDrawColor(pRenderer, 255, 255, 255, SDL_ALPHA_OPAQUE);
-
-                // Evil macro function
-                // Draw the wall segments for the edges
-                // Each wall is 1/5 thickness of the cell
-                // This function will calculate the position and
-                // orientation of the rectangles
-                #define DRAW_CELL(axis, isAxisX, floor, ceiling)\
-                do\
-                {\
-                    if(axis != floor && axis != ceiling) { break; }\
-                    \
-                    SDL_Rect r;\
-                    r.x = x * CELL_SIZE;\
-                    r.y = y * CELL_SIZE;\
-                    r.w = CELL_SIZE;\
-                    r.h = CELL_SIZE;\
-                    \
-                    if(isAxisX)\
-                    {\
-                        r.x = (axis == floor) ? axis * CELL_SIZE : (axis * CELL_SIZE) + (CELL_PADDING * 4);\
-                        r.w = CELL_PADDING;\
-                    }\
-                    else\
-                    {\
-                        r.y = (axis == floor) ? axis * CELL_SIZE : (axis * CELL_SIZE) + (CELL_PADDING * 4);\
-                        r.h = CELL_PADDING;\
-                    }\
-                    r.x += OFFSET_X;\
-                    r.y += OFFSET_Y;\
-                    SDL_RenderFillRect(pRenderer, &r);\
-                }while(FALSE)
-                DRAW_CELL(x, TRUE, 0, BOARD_WIDTH - 1);
-                DRAW_CELL(y, FALSE, 0, BOARD_HEIGHT - 1);
-                #undef DRAW_CELL
+                // Walls around the board are drawn as a bar CELL_PADDING thick
+                // along its edge, walls on the board as a whole cell
+                RendererSetColour(255, 255, 255, SDL_ALPHA_OPAQUE);
+                SDL_Rect r;
+                r.x = (x < 0) ? OFFSET_X - CELL_PADDING : OFFSET_X + (x * CELL);
+                r.y = (y < 0) ? OFFSET_Y - CELL_PADDING : OFFSET_Y + (y * CELL);
+                r.w = (x < 0 || x >= WIDTH) ? CELL_PADDING : CELL;
+                r.h = (y < 0 || y >= HEIGHT) ? CELL_PADDING : CELL;
+                RendererFillRect(&r);
                 continue;
             }
 
             if(CURRENT == cTypeFood)
             {
-                //SDL_SetRenderDrawColor(pRenderer, 155, 155, 155, SDL_ALPHA_OPAQUE);
+                //RendererSetColour(155, 155, 155, SDL_ALPHA_OPAQUE);
                 #define MAKE_RGB(x) x.r, x.g, x.b
-                SDL_SetRenderDrawColor(pRenderer, MAKE_RGB(RAINBOW[rainbowTick / 10]), SDL_ALPHA_OPAQUE);
+                RendererSetColour(MAKE_RGB(RAINBOW[rainbowTick / 10]), SDL_ALPHA_OPAQUE);
                 #undef MAKE_RGB
                 rainbowTick = (rainbowTick + 1) % (int)FPS;
             }
@@ -147,36 +328,43 @@ void BoardDraw(void)
             else if(CURRENT == cTypeSnake)
             {
                 // Draw the cells where the snake is supposed to be on
-                SDL_SetRenderDrawColor(pRenderer, 0, 255, 0, SDL_ALPHA_OPAQUE);
+                RendererSetColour(0, 255, 0, SDL_ALPHA_OPAQUE);
             }
             #endif // DEBUG
             else
             {
-                SDL_SetRenderDrawColor(pRenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+                RendererSetColour(0, 0, 0, SDL_ALPHA_OPAQUE);
             }
 
             SDL_Rect r;
-            r.w = CELL_SIZE;
-            r.h = CELL_SIZE;
-            r.x = OFFSET_X + (x * CELL_SIZE);
-            r.y = OFFSET_Y + (y * CELL_SIZE);
-            SDL_RenderFillRect(pRenderer, &r);
+            r.w = CELL;
+            r.h = CELL;
+            r.x = OFFSET_X + (x * CELL);
+            r.y = OFFSET_Y + (y * CELL);
+            RendererFillRect(&r);
         }
     }
 
-    // Draw the grid
+    // Draw the grid over the visible cells
     #ifdef DEBUG
-    SDL_SetRenderDrawColor(pRenderer, 255, 255, 255, SDL_ALPHA_OPAQUE);
-    for(ushort x = 0; x <= BOARD_WIDTH * CELL_SIZE; x += CELL_SIZE)
+    const int GRID_MIN_X = (minX > 0) ? minX : 0;
+    const int GRID_MIN_Y = (minY > 0) ? minY : 0;
+    const int GRID_MAX_X = (maxX < WIDTH) ? maxX + 1 : WIDTH;
+    const int GRID_MAX_Y = (maxY < HEIGHT) ? maxY + 1 : HEIGHT;
+    RendererSetColour(255, 255, 255, SDL_ALPHA_OPAQUE);
+    for(int x = GRID_MIN_X; x <= GRID_MAX_X; x++)
     {
-        SDL_RenderDrawLine(pRenderer, OFFSET_X + x, OFFSET_Y, OFFSET_X + x, OFFSET_Y + (BOARD_HEIGHT * CELL_SIZE));
+        RendererDrawLine(OFFSET_X + (x * CELL), OFFSET_Y + (GRID_MIN_Y * CELL), OFFSET_X + (x * CELL), OFFSET_Y + (GRID_MAX_Y * CELL));
     }
-    for(ushort y = 0; y <= BOARD_HEIGHT * CELL_SIZE; y += CELL_SIZE)
+    for(int y = GRID_MIN_Y; y <= GRID_MAX_Y; y++)
     {
-        SDL_RenderDrawLine(pRenderer, OFFSET_X, OFFSET_Y + y, OFFSET_X + (BOARD_WIDTH * CELL_SIZE), OFFSET_Y + y);
+        RendererDrawLine(OFFSET_X + (GRID_MIN_X * CELL), OFFSET_Y + (y * CELL), OFFSET_X + (GRID_MAX_X * CELL), OFFSET_Y + (y * CELL));
     }
     #endif // DEBUG
+
+    TRACE_END(BoardDraw);
 }
+#endif // !HEADLESS
 
 // Return TRUE if point is within the bounds
 // and cell type is either 'free' or 'food'
@@ -184,9 +372,8 @@ BOOL BoardIsCellValid(const Point point)
 {
     if(IsPointInBounds(point))
     {
-        const short INDEX = ToIndex(point);
-        return (cellArr[INDEX] == cTypeFree)
-            || (cellArr[INDEX] == cTypeFood);
+        const uint VALID_MASK = (1u << cTypeFree) | (1u << cTypeFood);
+        return (VALID_MASK >> ReadCell(ToIndex(point))) & 1;
     }
     return FALSE;
 }
@@ -197,7 +384,7 @@ void BoardSetCell(const Point point, const Celltype cell)
 {
     if(IsPointInBounds(point))
     {
-        cellArr[ToIndex(point)] = cell;
+        WriteCell(cellArr, ToIndex(point), cell);
     }
 }
 
@@ -207,29 +394,133 @@ Celltype BoardGetCell(const Point point)
 {
     if(IsPointInBounds(point))
     {
-        return cellArr[ToIndex(point)];
+        return (Celltype)ReadCell(ToIndex(point));
     }
     return cTypeWall;
 }
 
-// Find all free cells on the board and pick random
+// Return the board width in cells
+ushort BoardGetWidth(void)
+{
+    return boardWidth;
+}
+
+// Return the board height in cells
+ushort BoardGetHeight(void)
+{
+    return boardHeight;
+}
+
+// Return the raw cell storage, starting with the top wall row
+// Cell indices address it directly, the board itself starts one row in.
+// Rows are BoardGetRowStride() bytes apart, each cell is BOARD_CELL_BITS wide
+// and packed cells fill a byte from its lowest bits
+const uchar * BoardGetCells(void)
+{
+    return cellArr;
+}
+
+// Return the number of bytes between the starts of two rows
+uint BoardGetRowStride(void)
+{
+    return rowStride;
+}
+
+// Return the wrap table, NULL if the board has walls at its edges
+// Indexing it with a board cell or one of its neighbours gives the
+// cell the snake lands on, across the opposite edge if needed
+const uint * BoardGetWrapTable(void)
+{
+    return pWrapArr;
+}
+
+// Return the point of the last generated food
+// {-1, -1} if there was no free cell left
+Point BoardGetFood(void)
+{
+    return foodPoint;
+}
+
+// Seed the food placement generator
+// xorshift cannot leave the zero state, so zero is replaced
+void BoardSetSeed(const uint seed)
+{
+    rngState = (seed != 0) ? seed : 0x9E3779B9;
+}
+
+// Count the free cells on the board and pick random
 // cell to become food cell
 // Return TRUE if at least one free cell is found
 // Otherwise return FALSE
 BOOL BoardGenerateFood(void)
 {
-    const uint FREE_COUNT = BoardGetFreeCells();
+    TRACE_BEGIN(BoardGenerateFood);
+    const uint FREE_COUNT = BoardCountFreeCells();
     if(FREE_COUNT == 0)
     {
+        foodPoint.x = -1;
+        foodPoint.y = -1;
+        TRACE_END(BoardGenerateFood);
         return FALSE;
     }
     if(FREE_COUNT == 1)
     {
-        BoardSetCell(freeCellArr[0], cTypeFood);
+        foodPoint = BoardFindFreeCell(0);
     }
     else
     {
-        BoardSetCell(freeCellArr[rand() % FREE_COUNT], cTypeFood);
+        foodPoint = BoardFindFreeCell(NextRandom() % FREE_COUNT);
     }
+    BoardSetCell(foodPoint, cTypeFood);
+    TRACE_END(BoardGenerateFood);
     return TRUE;
 }
+
+// Return TRUE if the cell at the index is either 'free' or 'food'
+// The index must be below BoardGetCellCount(), which holds for every
+// board cell and its neighbours, so there is no range check
+BOOL BoardIsCellValidAt(const uint index)
+{
+    const uint VALID_MASK = (1u << cTypeFree) | (1u << cTypeFood);
+    return (VALID_MASK >> ReadCell(index)) & 1;
+}
+
+// Set a cell value at the index
+// The index must be a board cell
+void BoardSetCellAt(const uint index, const Celltype cell)
+{
+    WriteCell(cellArr, index, cell);
+}
+
+// Return cell value at the index
+// The index must be below BoardGetCellCount(); the border cells are walls
+Celltype BoardGetCellAt(const uint index)
+{
+    return (Celltype)ReadCell(index);
+}
+
+// Convert a point on the board to its cell index
+uint BoardToIndex(const Point point)
+{
+    return ToIndex(point);
+}
+
+// Convert a cell index back to a point
+// Only needed where coordinates matter, e.g. drawing
+Point BoardToPoint(const uint index)
+{
+    return (Point){(int)(index & (rowCells - 1)), (int)(index >> rowShift) - 1};
+}
+
+// Return the index distance between two rows, a power of two
+// Moving up or down one cell subtracts or adds this
+uint BoardGetRowCells(void)
+{
+    return rowCells;
+}
+
+// Return the number of cell indices, the wall rows included
+uint BoardGetCellCount(void)
+{
+    return cellCount;
+}
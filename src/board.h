@@ -2,6 +2,7 @@
 #define BOARD_H
 
 #include "types.h"
+#include "snapshot.h"
 
 typedef enum
 {
@@ -11,15 +12,53 @@ typedef enum
     cTypeFood  = 3,
 } Celltype;
 
+// Cell storage width in bits
+// One byte per cell by default, build with BOARD_PACKED_CELLS for two bits
+#ifdef BOARD_PACKED_CELLS
+#define BOARD_CELL_BITS 2
+#else
+#define BOARD_CELL_BITS 8
+#endif // BOARD_PACKED_CELLS
+
+// Index that never refers to a cell
+#define BOARD_NO_INDEX ((uint)-1)
+
+// Read a cell from a buffer in board storage format (see BoardGetCells())
+// The index must be within the buffer
+static inline uint BoardReadCellFrom(const uchar * pCells, const uint index)
+{
+    const uint SHIFT = (index % (8 / BOARD_CELL_BITS)) * BOARD_CELL_BITS;
+    return (pCells[index / (8 / BOARD_CELL_BITS)] >> SHIFT) & ((1u << BOARD_CELL_BITS) - 1);
+}
+
 // Main functions
-void BoardInitialise(void);
+BOOL BoardInitialise(const ushort width, const ushort height, const BOOL isWrapping);
 void BoardFree(void);
-void BoardDraw(void);
+void BoardDraw(const Snapshot * pSnapshot);
 
 // Helper functions
 BOOL BoardIsCellValid(const Point point);
 void BoardSetCell(const Point point, const Celltype cell);
 Celltype BoardGetCell(const Point point);
 BOOL BoardGenerateFood(void);
+ushort BoardGetWidth(void);
+ushort BoardGetHeight(void);
+const uchar * BoardGetCells(void);
+uint BoardGetRowStride(void);
+Point BoardGetFood(void);
+void BoardSetSeed(const uint seed);
+
+// Linear index functions
+// The simulation addresses cells by index, points are only used for drawing.
+// Indices are not range checked, the wall border keeps every neighbour
+// of a board cell inside the array
+BOOL BoardIsCellValidAt(const uint index);
+void BoardSetCellAt(const uint index, const Celltype cell);
+Celltype BoardGetCellAt(const uint index);
+uint BoardToIndex(const Point point);
+Point BoardToPoint(const uint index);
+uint BoardGetRowCells(void);
+uint BoardGetCellCount(void);
+const uint * BoardGetWrapTable(void);
 
 #endif // !BOARD_H
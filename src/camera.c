@@ -0,0 +1,146 @@
+#include "camera.h"
+
+#include <math.h>
+
+#include "globals.h"
+#include "renderer.h"
+
+// Fraction of the distance to the head left after one second is
+// exp(-FOLLOW_RATE), independent of the frame rate
+#define FOLLOW_RATE 6.0f
+
+// Smallest cell drawn, the snake's rectangles are a fifth of a cell wide
+#define MIN_CELL_SIZE 5
+
+// Internal variables
+// The centre is the point of the board, in board pixels,
+// shown in the middle of the window
+static float  zoom = 1.0f;
+static int    cellSize;   // 0 until the first update
+static float  centreX;
+static float  centreY;
+static int    offsetX;
+static int    offsetY;
+static int    visibleMinX;
+static int    visibleMinY;
+static int    visibleMaxX;
+static int    visibleMaxY;
+static uint   cameraGameId;
+static BOOL   isFixed = TRUE;
+
+// Internal functions
+
+// Divide rounding towards negative infinity
+static inline int FloorDivide(const int a, const int b)
+{
+    return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+// Return value limited to [min, max]
+static inline int Clamp(const int value, const int min, const int max)
+{
+    return (value < min) ? min : (value > max) ? max : value;
+}
+
+// Place the board along one axis and return the window
+// position of its first pixel
+// A board that fits is centred, a larger one is scrolled so that
+// the centre moves towards 'target' and the window stays within
+// the board and its walls
+static int PlaceAxis(float * pCentre, const int windowSize, const int boardSize,
+                     const float target, const float ease, const BOOL isSnapping)
+{
+    if(boardSize <= windowSize)
+    {
+        *pCentre = boardSize / 2.0f;
+        return (windowSize / 2) - (boardSize / 2);
+    }
+    const float HALF = windowSize / 2.0f;
+    float centre = *pCentre + ((target - *pCentre) * ease);
+    if(isSnapping || fabsf(target - *pCentre) > HALF)
+    {
+        centre = target;
+    }
+
+    const float MIN = HALF - cellSize;
+    const float MAX = boardSize + cellSize - HALF;
+    centre = (centre < MIN) ? MIN : (centre > MAX) ? MAX : centre;
+    *pCentre = centre;
+    return (int)floorf(HALF - centre);
+}
+
+// Public functions
+
+// Move the camera towards the head of the snapshot's snake, 'seconds'
+// after the last update, and work out the cells in view
+// Called once per frame, before anything is drawn on the board
+void CameraUpdate(const Snapshot * pSnapshot, const float seconds)
+{
+    int windowWidth = 0;
+    int windowHeight = 0;
+    RendererGetWindowSize(&windowWidth, &windowHeight);
+
+    const int NEW_CELL_SIZE = (int)((CELL_SIZE * zoom) + 0.5f);
+    const int CELL = (NEW_CELL_SIZE > MIN_CELL_SIZE) ? NEW_CELL_SIZE : MIN_CELL_SIZE;
+    const int WIDTH  = pSnapshot->width;
+    const int HEIGHT = pSnapshot->height;
+    const BOOL IS_SNAPPING = pSnapshot->gameId != cameraGameId || CELL != cellSize;
+    cellSize     = CELL;
+    cameraGameId = pSnapshot->gameId;
+
+    // Follow the centre of the head's cell, or stay on the board's
+    float targetX = (WIDTH * CELL) / 2.0f;
+    float targetY = (HEIGHT * CELL) / 2.0f;
+    if(pSnapshot->length > 0)
+    {
+        targetX = (pSnapshot->pBodyArr[0].x * CELL) + (CELL / 2.0f);
+        targetY = (pSnapshot->pBodyArr[0].y * CELL) + (CELL / 2.0f);
+    }
+    const float EASE = 1.0f - expf(-seconds * FOLLOW_RATE);
+    offsetX = PlaceAxis(&centreX, windowWidth, WIDTH * CELL, targetX, EASE, IS_SNAPPING);
+    offsetY = PlaceAxis(&centreY, windowHeight, HEIGHT * CELL, targetY, EASE, IS_SNAPPING);
+    isFixed = (CELL == CELL_SIZE && WIDTH * CELL <= windowWidth && HEIGHT * CELL <= windowHeight);
+
+    // Cells partly in the window, the wall border included
+    visibleMinX = Clamp(FloorDivide(-offsetX, CELL), -1, WIDTH);
+    visibleMinY = Clamp(FloorDivide(-offsetY, CELL), -1, HEIGHT);
+    visibleMaxX = Clamp(FloorDivide(windowWidth - 1 - offsetX, CELL), -1, WIDTH);
+    visibleMaxY = Clamp(FloorDivide(windowHeight - 1 - offsetY, CELL), -1, HEIGHT);
+}
+
+// Set the size of the cells relative to CELL_SIZE
+// The zoom is clamped to [MIN_ZOOM, MAX_ZOOM]
+void CameraSetZoom(const float newZoom)
+{
+    zoom = (newZoom < MIN_ZOOM) ? MIN_ZOOM : (newZoom > MAX_ZOOM) ? MAX_ZOOM : newZoom;
+}
+
+// Return the size of a cell in pixels
+int CameraGetCellSize(void)
+{
+    return (cellSize > 0) ? cellSize : CELL_SIZE;
+}
+
+// Get the window position of the top-left corner of cell (0, 0)
+void CameraGetOffset(int * pX, int * pY)
+{
+    *pX = offsetX;
+    *pY = offsetY;
+}
+
+// Get the inclusive range of cells in the window
+// The range is within the board and its wall border, [-1, width] by [-1, height]
+void CameraGetVisibleCells(int * pMinX, int * pMinY, int * pMaxX, int * pMaxY)
+{
+    *pMinX = visibleMinX;
+    *pMinY = visibleMinY;
+    *pMaxX = visibleMaxX;
+    *pMaxY = visibleMaxY;
+}
+
+// Return TRUE if the whole board is centred at CELL_SIZE,
+// the only view the cached and mesh snake renderers can draw
+BOOL CameraIsFixed(void)
+{
+    return isFixed;
+}
@@ -0,0 +1,31 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include "types.h"
+#include "snapshot.h"
+
+// Camera over the board
+//
+// A board that fits in the window at the camera's zoom is centred in it,
+// as it always was. On a larger board the camera follows the snake's head,
+// easing towards it and stopping at the board's edges. It jumps straight
+// to the head when the head leaves the window, at the start of a game or
+// across the edge of a wrapping board.
+//
+// Everything drawn on the board takes its cell size, the window position
+// of cell (0, 0) and the range of cells in view from the camera, so the
+// cost of a frame depends on the size of the window, not of the board
+#define MIN_ZOOM 0.2f
+#define MAX_ZOOM 4.0f
+
+// Main functions
+void CameraUpdate(const Snapshot * pSnapshot, const float seconds);
+
+// Helper functions
+void CameraSetZoom(const float zoom);
+int CameraGetCellSize(void);
+void CameraGetOffset(int * pX, int * pY);
+void CameraGetVisibleCells(int * pMinX, int * pMinY, int * pMaxX, int * pMaxY);
+BOOL CameraIsFixed(void);
+
+#endif // !CAMERA_H
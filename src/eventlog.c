@@ -0,0 +1,272 @@
+#include "eventlog.h"
+
+#include <string.h>
+#include <SDL2/SDL.h>
+
+// Ring size in records, must be a power of two
+#define RING_SIZE 4096
+
+// How often the logger drains the ring
+#define DRAIN_INTERVAL_MS 10
+
+// Log files are rotated once they reach this size
+#define MAX_FILE_SIZE (8 * 1024 * 1024)
+
+#define EVENTLOG_VERSION 1
+#define HEADER_SIZE      16
+
+static const char HEADER_MAGIC[8] = { 'R', 'S', 'E', 'V', 'E', 'N', 'T', 'S' };
+
+static const char * EVENT_NAMES[] =
+{
+    "start", "move", "eat", "defeat", "victory", "pause", "resume", "speed", "direction", "dropped",
+};
+
+// Internal variables for the ring
+// Single producer and single consumer, so each index is
+// only ever written by one side. Records hold the raw
+// performance counter until the logger converts it
+static EventRecord  ringArr[RING_SIZE];
+static SDL_atomic_t ringHead;
+static SDL_atomic_t ringTail;
+static SDL_atomic_t droppedCount;
+
+// Internal variables for the logger thread
+static SDL_Thread * pThread;
+static SDL_atomic_t isQuitting;
+
+// Internal variables for the log file
+// Only used by the logger
+static char         pathArr[256];
+static FILE *       pFile;
+static long         fileSize;
+static Uint64       startTime;
+static uint         totalDropped;
+static EventRecord  batchArr[RING_SIZE + 1];
+
+// Internal functions
+
+// Open a new log file at pathArr, moving the current one to "<path>.1"
+// Return FALSE if the file cannot be created
+static BOOL OpenFile(const BOOL isRotating)
+{
+    if(pFile)
+    {
+        fclose(pFile);
+        pFile = NULL;
+    }
+    if(isRotating)
+    {
+        char oldPathArr[sizeof(pathArr) + 2];
+        snprintf(oldPathArr, sizeof(oldPathArr), "%s.1", pathArr);
+        remove(oldPathArr);
+        rename(pathArr, oldPathArr);
+    }
+
+    pFile = fopen(pathArr, "wb");
+    if(!pFile)
+    {
+        return FALSE;
+    }
+    uchar headerArr[HEADER_SIZE];
+    const uint32_t VERSION = EVENTLOG_VERSION;
+    const uint32_t RECORD_SIZE = sizeof(EventRecord);
+    memcpy(headerArr, HEADER_MAGIC, sizeof(HEADER_MAGIC));
+    memcpy(headerArr + 8, &VERSION, sizeof(VERSION));
+    memcpy(headerArr + 12, &RECORD_SIZE, sizeof(RECORD_SIZE));
+    fwrite(headerArr, 1, HEADER_SIZE, pFile);
+    fileSize = HEADER_SIZE;
+    return TRUE;
+}
+
+// Convert a performance counter value into microseconds since the start
+static inline uint64_t ToMicroseconds(const Uint64 counter)
+{
+    const Uint64 FREQUENCY = SDL_GetPerformanceFrequency();
+    const Uint64 ELAPSED = counter - startTime;
+    return (ELAPSED / FREQUENCY) * 1000000 + ((ELAPSED % FREQUENCY) * 1000000) / FREQUENCY;
+}
+
+// Move every queued record into the log file
+// Dropped events are logged after the records that made it
+static void Drain(void)
+{
+    const uint HEAD = (uint)SDL_AtomicGet(&ringHead);
+    SDL_MemoryBarrierAcquire();
+
+    uint count = 0;
+    uint tail = (uint)SDL_AtomicGet(&ringTail);
+    for(; tail != HEAD; tail++)
+    {
+        batchArr[count] = ringArr[tail & (RING_SIZE - 1)];
+        batchArr[count].time = ToMicroseconds(batchArr[count].time);
+        count++;
+    }
+
+    // The slots must be read before the producer can reuse them
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&ringTail, (int)tail);
+
+    const uint DROPPED = (uint)SDL_AtomicSet(&droppedCount, 0);
+    if(DROPPED > 0)
+    {
+        EventRecord * pRecord = &batchArr[count++];
+        memset(pRecord, 0, sizeof(EventRecord));
+        pRecord->time  = ToMicroseconds(SDL_GetPerformanceCounter());
+        pRecord->type  = cEventDropped;
+        pRecord->value = DROPPED;
+        totalDropped  += DROPPED;
+    }
+
+    if(count == 0 || !pFile)
+    {
+        return;
+    }
+    if(fileSize + (long)(count * sizeof(EventRecord)) > MAX_FILE_SIZE && !OpenFile(TRUE))
+    {
+        return;
+    }
+    fwrite(batchArr, sizeof(EventRecord), count, pFile);
+    fflush(pFile);
+    fileSize += (long)(count * sizeof(EventRecord));
+}
+
+// Thread function
+// Drain the ring at a fixed interval until the log is freed
+static int EventLogMain(void * pData)
+{
+    (void)pData;
+    while(!SDL_AtomicGet(&isQuitting))
+    {
+        Drain();
+        SDL_Delay(DRAIN_INTERVAL_MS);
+    }
+    Drain();
+    return 0;
+}
+
+// Public functions
+
+// "Constructor"
+// Create the log file and start the logger thread
+// Must be called before the producer starts emitting
+// Return FALSE if the file or the thread cannot be created
+BOOL EventLogInitialise(const char * pPath)
+{
+    if(strlen(pPath) >= sizeof(pathArr))
+    {
+        return FALSE;
+    }
+    strcpy(pathArr, pPath);
+    if(!OpenFile(FALSE))
+    {
+        return FALSE;
+    }
+
+    startTime    = SDL_GetPerformanceCounter();
+    totalDropped = 0;
+    SDL_AtomicSet(&ringHead, 0);
+    SDL_AtomicSet(&ringTail, 0);
+    SDL_AtomicSet(&droppedCount, 0);
+    SDL_AtomicSet(&isQuitting, 0);
+    pThread = SDL_CreateThread(EventLogMain, "eventlog", NULL);
+    if(!pThread)
+    {
+        fclose(pFile);
+        pFile = NULL;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+// "Destructor"
+// Write the remaining events and stop the logger thread
+// The producer must have stopped emitting
+void EventLogFree(void)
+{
+    if(pThread)
+    {
+        SDL_AtomicSet(&isQuitting, 1);
+        SDL_WaitThread(pThread, NULL);
+        pThread = NULL;
+    }
+    if(pFile)
+    {
+        fclose(pFile);
+        pFile = NULL;
+    }
+}
+
+// Queue an event for the logger
+// Never blocks; the event is dropped and counted if the ring is full
+void EventLogEmit(const EventType type, const uint gameId, const uint tick, const uint value)
+{
+    if(!pThread)
+    {
+        return;
+    }
+    const uint HEAD = (uint)SDL_AtomicGet(&ringHead);
+    if(HEAD - (uint)SDL_AtomicGet(&ringTail) == RING_SIZE)
+    {
+        SDL_AtomicAdd(&droppedCount, 1);
+        return;
+    }
+    EventRecord * pRecord = &ringArr[HEAD & (RING_SIZE - 1)];
+    pRecord->time   = SDL_GetPerformanceCounter();
+    pRecord->gameId = gameId;
+    pRecord->tick   = tick;
+    pRecord->value  = value;
+    pRecord->type   = (uint8_t)type;
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&ringHead, (int)(HEAD + 1));
+}
+
+// Return the number of events dropped so far
+// Only valid after EventLogFree()
+uint EventLogGetDroppedCount(void)
+{
+    return totalDropped;
+}
+
+// Print a binary log file as text, one event per line
+// Return FALSE if the file is not an event log
+BOOL EventLogDecode(FILE * pInFile, FILE * pOutFile)
+{
+    uchar headerArr[HEADER_SIZE];
+    uint32_t version;
+    uint32_t recordSize;
+    if(fread(headerArr, 1, HEADER_SIZE, pInFile) != HEADER_SIZE
+    || memcmp(headerArr, HEADER_MAGIC, sizeof(HEADER_MAGIC)) != 0)
+    {
+        return FALSE;
+    }
+    memcpy(&version, headerArr + 8, sizeof(version));
+    memcpy(&recordSize, headerArr + 12, sizeof(recordSize));
+    if(version != EVENTLOG_VERSION || recordSize != sizeof(EventRecord))
+    {
+        return FALSE;
+    }
+
+    EventRecord record;
+    while(fread(&record, sizeof(EventRecord), 1, pInFile) == 1)
+    {
+        const char * pName = (record.type <= cEventDropped) ? EVENT_NAMES[record.type] : "unknown";
+        fprintf(pOutFile, "%12.3f ms  game %-6u tick %-8u %-9s", record.time / 1000.0, record.gameId, record.tick, pName);
+        switch(record.type)
+        {
+            case cEventMove:
+                fprintf(pOutFile, " %u,%u\n", record.value & 0xFFFF, record.value >> 16);
+                break;
+
+            case cEventPause:
+            case cEventResume:
+                fprintf(pOutFile, "\n");
+                break;
+
+            default:
+                fprintf(pOutFile, " %u\n", record.value);
+                break;
+        }
+    }
+    return TRUE;
+}
@@ -0,0 +1,52 @@
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "types.h"
+
+// Gameplay event log
+//
+// Events are written into a fixed-size lock-free ring by a single producer
+// (the simulation runner) without locks, allocation or I/O. A background
+// thread drains the ring into a binary log file, which is rotated to
+// "<path>.1" when it grows too large. If the ring is full the event is
+// dropped and counted; the logger records the count as a cEventDropped event.
+//
+// File layout: "RSEVENTS", uint32 version, uint32 record size, then records
+typedef enum
+{
+    cEventGameStart = 0,  // value: seed
+    cEventMove      = 1,  // value: head x | (y << 16)
+    cEventEat       = 2,  // value: score
+    cEventDefeat    = 3,  // value: score
+    cEventVictory   = 4,  // value: score
+    cEventPause     = 5,
+    cEventResume    = 6,
+    cEventSpeed     = 7,  // value: updates per second
+    cEventDirection = 8,  // value: Direction
+    cEventDropped   = 9,  // value: events lost since the previous one
+} EventType;
+
+// Log record, 24 bytes
+typedef struct
+{
+    uint64_t time;        // Microseconds since the log was started
+    uint32_t gameId;
+    uint32_t tick;        // Game tick count when the event happened
+    uint32_t value;
+    uint8_t  type;        // EventType
+    uint8_t  reserved[3];
+} EventRecord;
+
+// Main functions
+BOOL EventLogInitialise(const char * pPath);
+void EventLogFree(void);
+
+// Helper functions
+void EventLogEmit(const EventType type, const uint gameId, const uint tick, const uint value);
+uint EventLogGetDroppedCount(void);
+BOOL EventLogDecode(FILE * pInFile, FILE * pOutFile);
+
+#endif // !EVENTLOG_H
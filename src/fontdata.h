@@ -0,0 +1,1788 @@
+// Generated by tools/fontatlas.c from font.ttf at 32 points - do not edit
+// Regenerate with 'make -f makefile_unix font_atlas'
+
+#ifndef FONTDATA_H
+#define FONTDATA_H
+
+#include "types.h"
+
+#define FONT_POINT_SIZE   32
+#define FONT_ASCENT       32
+#define FONT_HEIGHT       44
+#define FONT_FIRST_CHAR   32
+#define FONT_LAST_CHAR    126
+#define FONT_ATLAS_WIDTH  256
+#define FONT_ATLAS_HEIGHT 219
+
+// Atlas rectangle, offset from the pen position on the baseline, and advance
+typedef struct
+{
+    ushort x;
+    ushort y;
+    uchar  w;
+    uchar  h;
+    short  left;
+    short  top;
+    uchar  advance;
+} FontGlyph;
+
+static const FontGlyph FONT_GLYPH_ARR[95] =
+{
+    {   0,   0,  1,  1,  0,  1,  8 }, // ' '
+    {   2,   0,  4, 28,  0, 28,  8 }, // '!'
+    {   7,   0, 12,  8,  0, 28, 16 }, // '"'
+    {  20,   0, 20, 28,  0, 28, 24 }, // '#'
+    {  41,   0, 20, 36,  0, 32, 24 }, // '$'
+    {  62,   0, 20, 28,  0, 28, 24 }, // '%'
+    {  83,   0, 20, 28,  0, 28, 24 }, // '&'
+    { 104,   0,  8,  8,  0, 28, 12 }, // '''
+    { 113,   0, 12, 28,  0, 28, 16 }, // '('
+    { 126,   0, 12, 28,  0, 28, 16 }, // ')'
+    { 139,   0, 20, 28,  0, 28, 24 }, // '*'
+    { 160,   0, 20, 20,  0, 24, 24 }, // '+'
+    { 181,   0,  4,  8,  0,  4,  8 }, // ','
+    { 186,   0, 16,  4,  0, 16, 20 }, // '-'
+    { 203,   0,  4,  4,  0,  4,  8 }, // '.'
+    { 208,   0, 12, 28,  0, 28, 16 }, // '/'
+    { 221,   0, 20, 28,  0, 28, 24 }, // '0'
+    { 242,   0, 12, 28,  0, 28, 16 }, // '1'
+    {   0,  37, 20, 28,  0, 28, 24 }, // '2'
+    {  21,  37, 20, 28,  0, 28, 24 }, // '3'
+    {  42,  37, 20, 28,  0, 28, 24 }, // '4'
+    {  63,  37, 20, 28,  0, 28, 24 }, // '5'
+    {  84,  37, 20, 28,  0, 28, 24 }, // '6'
+    { 105,  37, 20, 28,  0, 28, 24 }, // '7'
+    { 126,  37, 20, 28,  0, 28, 24 }, // '8'
+    { 147,  37, 20, 28,  0, 28, 24 }, // '9'
+    { 168,  37,  4, 24,  0, 24,  8 }, // ':'
+    { 173,  37,  4, 28,  0, 24,  8 }, // ';'
+    { 178,  37, 16, 28,  0, 28, 20 }, // '<'
+    { 195,  37, 16, 12,  0, 20, 20 }, // '='
+    { 212,  37, 16, 28,  0, 28, 20 }, // '>'
+    { 229,  37, 20, 28,  0, 28, 24 }, // '?'
+    {   0,  66, 20, 28,  0, 28, 24 }, // '@'
+    {  21,  66, 20, 28,  0, 28, 24 }, // 'A'
+    {  42,  66, 20, 28,  0, 28, 24 }, // 'B'
+    {  63,  66, 20, 28,  0, 28, 24 }, // 'C'
+    {  84,  66, 20, 28,  0, 28, 24 }, // 'D'
+    { 105,  66, 20, 28,  0, 28, 24 }, // 'E'
+    { 126,  66, 20, 28,  0, 28, 24 }, // 'F'
+    { 147,  66, 20, 28,  0, 28, 24 }, // 'G'
+    { 168,  66, 20, 28,  0, 28, 24 }, // 'H'
+    { 189,  66, 12, 28,  0, 28, 16 }, // 'I'
+    { 202,  66, 20, 28,  0, 28, 24 }, // 'J'
+    { 223,  66, 20, 28,  0, 28, 24 }, // 'K'
+    {   0,  95, 20, 28,  0, 28, 24 }, // 'L'
+    {  21,  95, 20, 28,  0, 28, 24 }, // 'M'
+    {  42,  95, 20, 28,  0, 28, 24 }, // 'N'
+    {  63,  95, 20, 28,  0, 28, 24 }, // 'O'
+    {  84,  95, 20, 28,  0, 28, 24 }, // 'P'
+    { 105,  95, 20, 28,  0, 28, 24 }, // 'Q'
+    { 126,  95, 20, 28,  0, 28, 24 }, // 'R'
+    { 147,  95, 20, 28,  0, 28, 24 }, // 'S'
+    { 168,  95, 20, 28,  0, 28, 24 }, // 'T'
+    { 189,  95, 20, 28,  0, 28, 24 }, // 'U'
+    { 210,  95, 20, 28,  0, 28, 24 }, // 'V'
+    { 231,  95, 20, 28,  0, 28, 24 }, // 'W'
+    {   0, 124, 20, 28,  0, 28, 24 }, // 'X'
+    {  21, 124, 20, 28,  0, 28, 24 }, // 'Y'
+    {  42, 124, 20, 28,  0, 28, 24 }, // 'Z'
+    {  63, 124, 12, 28,  0, 28, 16 }, // '['
+    {  76, 124, 12, 28,  0, 28, 16 }, // '\'
+    {  89, 124, 12, 28,  0, 28, 16 }, // ']'
+    { 102, 124, 20, 12,  0, 28, 24 }, // '^'
+    { 123, 124, 20,  4,  0,  4, 24 }, // '_'
+    { 144, 124,  8,  8,  0, 28, 12 }, // '`'
+    { 153, 124, 20, 28,  0, 28, 24 }, // 'a'
+    { 174, 124, 20, 28,  0, 28, 24 }, // 'b'
+    { 195, 124, 20, 28,  0, 28, 24 }, // 'c'
+    { 216, 124, 20, 28,  0, 28, 24 }, // 'd'
+    {   0, 153, 20, 28,  0, 28, 24 }, // 'e'
+    {  21, 153, 20, 28,  0, 28, 24 }, // 'f'
+    {  42, 153, 20, 28,  0, 28, 24 }, // 'g'
+    {  63, 153, 20, 28,  0, 28, 24 }, // 'h'
+    {  84, 153, 12, 28,  0, 28, 16 }, // 'i'
+    {  97, 153, 20, 28,  0, 28, 24 }, // 'j'
+    { 118, 153, 20, 28,  0, 28, 24 }, // 'k'
+    { 139, 153, 20, 28,  0, 28, 24 }, // 'l'
+    { 160, 153, 20, 28,  0, 28, 24 }, // 'm'
+    { 181, 153, 20, 28,  0, 28, 24 }, // 'n'
+    { 202, 153, 20, 28,  0, 28, 24 }, // 'o'
+    { 223, 153, 20, 28,  0, 28, 24 }, // 'p'
+    {   0, 182, 20, 28,  0, 28, 24 }, // 'q'
+    {  21, 182, 20, 28,  0, 28, 24 }, // 'r'
+    {  42, 182, 20, 28,  0, 28, 24 }, // 's'
+    {  63, 182, 20, 28,  0, 28, 24 }, // 't'
+    {  84, 182, 20, 28,  0, 28, 24 }, // 'u'
+    { 105, 182, 20, 28,  0, 28, 24 }, // 'v'
+    { 126, 182, 20, 28,  0, 28, 24 }, // 'w'
+    { 147, 182, 20, 28,  0, 28, 24 }, // 'x'
+    { 168, 182, 20, 28,  0, 28, 24 }, // 'y'
+    { 189, 182, 20, 28,  0, 28, 24 }, // 'z'
+    { 210, 182, 12, 28,  0, 28, 16 }, // '{'
+    { 223, 182,  4, 28,  0, 28,  8 }, // '|'
+    { 228, 182, 12, 28,  0, 28, 16 }, // '}'
+    {   0, 211, 16,  8,  0, 20, 20 }, // '~'
+};
+
+// One bit per pixel, 32 bytes per row, leftmost pixel in the highest bit
+static const uchar FONT_ATLAS_BITS[7008] =
+{
+    0x3d, 0xe1, 0xe0, 0xf0, 0xf0, 0x00, 0x78, 0x03, 0xfc, 0x3c, 0x01, 0xfe, 0x00, 0x0f, 0x00, 0x7b,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0x07, 0xbf, 0xff, 0xde, 0x00, 0xf0, 0x7f, 0xf8, 0x03, 0xc0,
+    0x3d, 0xe1, 0xe0, 0xf0, 0xf0, 0x00, 0x78, 0x03, 0xfc, 0x3c, 0x01, 0xfe, 0x00, 0x0f, 0x00, 0x7b,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0x07, 0xbf, 0xff, 0xde, 0x00, 0xf0, 0x7f, 0xf8, 0x03, 0xc0,
+    0x3d, 0xe1, 0xe0, 0xf0, 0xf0, 0x00, 0x78, 0x03, 0xfc, 0x3c, 0x01, 0xfe, 0x00, 0x0f, 0x00, 0x7b,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0x07, 0xbf, 0xff, 0xde, 0x00, 0xf0, 0x7f, 0xf8, 0x03, 0xc0,
+    0x3d, 0xe1, 0xe0, 0xf0, 0xf0, 0x00, 0x78, 0x03, 0xfc, 0x3c, 0x01, 0xfe, 0x00, 0x0f, 0x00, 0x7b,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0x07, 0xbf, 0xff, 0xde, 0x00, 0xf0, 0x7f, 0xf8, 0x03, 0xc0,
+    0x3d, 0xe1, 0xe0, 0xf0, 0xf0, 0x07, 0xff, 0x83, 0xfc, 0x3c, 0x1e, 0x01, 0xe0, 0xf0, 0x07, 0x80,
+    0x3c, 0x1e, 0x1e, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x00, 0x00, 0x00, 0xf7, 0x80, 0x07, 0xbf, 0xc0,
+    0x3d, 0xe1, 0xe0, 0xf0, 0xf0, 0x07, 0xff, 0x83, 0xfc, 0x3c, 0x1e, 0x01, 0xe0, 0xf0, 0x07, 0x80,
+    0x3c, 0x1e, 0x1e, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x00, 0x00, 0x00, 0xf7, 0x80, 0x07, 0xbf, 0xc0,
+    0x3d, 0xe1, 0xe0, 0xf0, 0xf0, 0x07, 0xff, 0x83, 0xfc, 0x3c, 0x1e, 0x01, 0xe0, 0xf0, 0x07, 0x80,
+    0x3c, 0x1e, 0x1e, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x00, 0x00, 0x00, 0xf7, 0x80, 0x07, 0xbf, 0xc0,
+    0x3d, 0xe1, 0xe0, 0xf0, 0xf0, 0x07, 0xff, 0x83, 0xfc, 0x3c, 0x1e, 0x01, 0xe0, 0xf0, 0x07, 0x80,
+    0x3c, 0x1e, 0x1e, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x00, 0x00, 0x00, 0xf7, 0x80, 0x07, 0xbf, 0xc0,
+    0x3c, 0x00, 0x0f, 0xff, 0xff, 0x78, 0x78, 0x78, 0x03, 0xc0, 0x1e, 0x01, 0xe0, 0x00, 0x78, 0x00,
+    0x03, 0xc1, 0xff, 0xe0, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x80, 0x7f, 0x83, 0xc0,
+    0x3c, 0x00, 0x0f, 0xff, 0xff, 0x78, 0x78, 0x78, 0x03, 0xc0, 0x1e, 0x01, 0xe0, 0x00, 0x78, 0x00,
+    0x03, 0xc1, 0xff, 0xe0, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x80, 0x7f, 0x83, 0xc0,
+    0x3c, 0x00, 0x0f, 0xff, 0xff, 0x78, 0x78, 0x78, 0x03, 0xc0, 0x1e, 0x01, 0xe0, 0x00, 0x78, 0x00,
+    0x03, 0xc1, 0xff, 0xe0, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x80, 0x7f, 0x83, 0xc0,
+    0x3c, 0x00, 0x0f, 0xff, 0xff, 0x78, 0x78, 0x78, 0x03, 0xc0, 0x1e, 0x01, 0xe0, 0x00, 0x78, 0x00,
+    0x03, 0xc1, 0xff, 0xe0, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x80, 0x7f, 0x83, 0xc0,
+    0x3c, 0x00, 0x00, 0xf0, 0xf0, 0x78, 0x78, 0x00, 0x03, 0xc0, 0x01, 0xfe, 0x00, 0x00, 0x78, 0x00,
+    0x03, 0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x87, 0x87, 0x83, 0xc0,
+    0x3c, 0x00, 0x00, 0xf0, 0xf0, 0x78, 0x78, 0x00, 0x03, 0xc0, 0x01, 0xfe, 0x00, 0x00, 0x78, 0x00,
+    0x03, 0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x87, 0x87, 0x83, 0xc0,
+    0x3c, 0x00, 0x00, 0xf0, 0xf0, 0x78, 0x78, 0x00, 0x03, 0xc0, 0x01, 0xfe, 0x00, 0x00, 0x78, 0x00,
+    0x03, 0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x87, 0x87, 0x83, 0xc0,
+    0x3c, 0x00, 0x00, 0xf0, 0xf0, 0x78, 0x78, 0x00, 0x03, 0xc0, 0x01, 0xfe, 0x00, 0x00, 0x78, 0x00,
+    0x03, 0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x87, 0x87, 0x83, 0xc0,
+    0x3c, 0x00, 0x0f, 0xff, 0xff, 0x07, 0xff, 0x80, 0x03, 0xc0, 0x1e, 0x01, 0xe0, 0x00, 0x78, 0x00,
+    0x03, 0xc1, 0xff, 0xe0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0xf8, 0x07, 0x83, 0xc0,
+    0x3c, 0x00, 0x0f, 0xff, 0xff, 0x07, 0xff, 0x80, 0x03, 0xc0, 0x1e, 0x01, 0xe0, 0x00, 0x78, 0x00,
+    0x03, 0xc1, 0xff, 0xe0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0xf8, 0x07, 0x83, 0xc0,
+    0x3c, 0x00, 0x0f, 0xff, 0xff, 0x07, 0xff, 0x80, 0x03, 0xc0, 0x1e, 0x01, 0xe0, 0x00, 0x78, 0x00,
+    0x03, 0xc1, 0xff, 0xe0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0xf8, 0x07, 0x83, 0xc0,
+    0x3c, 0x00, 0x0f, 0xff, 0xff, 0x07, 0xff, 0x80, 0x03, 0xc0, 0x1e, 0x01, 0xe0, 0x00, 0x78, 0x00,
+    0x03, 0xc1, 0xff, 0xe0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0xf8, 0x07, 0x83, 0xc0,
+    0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x78, 0x78, 0x3c, 0x3f, 0xde, 0x00, 0x1e, 0x00, 0x07, 0x80,
+    0x3c, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x83, 0xc0,
+    0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x78, 0x78, 0x3c, 0x3f, 0xde, 0x00, 0x1e, 0x00, 0x07, 0x80,
+    0x3c, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x83, 0xc0,
+    0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x78, 0x78, 0x3c, 0x3f, 0xde, 0x00, 0x1e, 0x00, 0x07, 0x80,
+    0x3c, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x83, 0xc0,
+    0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x78, 0x78, 0x3c, 0x3f, 0xde, 0x00, 0x1e, 0x00, 0x07, 0x80,
+    0x3c, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x83, 0xc0,
+    0x3c, 0x00, 0x00, 0xf0, 0xf0, 0x78, 0x78, 0x78, 0x3c, 0x3f, 0xc1, 0xff, 0xfe, 0x00, 0x00, 0x7b,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x7f, 0xf8, 0x3f, 0xfc,
+    0x3c, 0x00, 0x00, 0xf0, 0xf0, 0x78, 0x78, 0x78, 0x3c, 0x3f, 0xc1, 0xff, 0xfe, 0x00, 0x00, 0x7b,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x7f, 0xf8, 0x3f, 0xfc,
+    0x3c, 0x00, 0x00, 0xf0, 0xf0, 0x78, 0x78, 0x78, 0x3c, 0x3f, 0xc1, 0xff, 0xfe, 0x00, 0x00, 0x7b,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x7f, 0xf8, 0x3f, 0xfc,
+    0x3c, 0x00, 0x00, 0xf0, 0xf0, 0x78, 0x78, 0x78, 0x3c, 0x3f, 0xc1, 0xff, 0xfe, 0x00, 0x00, 0x7b,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x7f, 0xf8, 0x3f, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0xff, 0x07, 0xff, 0xff, 0x80, 0x03, 0xc1, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0x7f, 0xff, 0xf8,
+    0x3f, 0xfc, 0x01, 0xff, 0xe0, 0xf7, 0x80, 0x03, 0xdf, 0xff, 0xef, 0x00, 0x00, 0x7f, 0xf8, 0x00,
+    0x0f, 0xff, 0x07, 0xff, 0xff, 0x80, 0x03, 0xc1, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0x7f, 0xff, 0xf8,
+    0x3f, 0xfc, 0x01, 0xff, 0xe0, 0xf7, 0x80, 0x03, 0xdf, 0xff, 0xef, 0x00, 0x00, 0x7f, 0xf8, 0x00,
+    0x0f, 0xff, 0x07, 0xff, 0xff, 0x80, 0x03, 0xc1, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0x7f, 0xff, 0xf8,
+    0x3f, 0xfc, 0x01, 0xff, 0xe0, 0xf7, 0x80, 0x03, 0xdf, 0xff, 0xef, 0x00, 0x00, 0x7f, 0xf8, 0x00,
+    0x0f, 0xff, 0x07, 0xff, 0xff, 0x80, 0x03, 0xc1, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0x7f, 0xff, 0xf8,
+    0x3f, 0xfc, 0x01, 0xff, 0xe0, 0xf7, 0x80, 0x03, 0xdf, 0xff, 0xef, 0x00, 0x00, 0x7f, 0xf8, 0x00,
+    0xf0, 0x00, 0xf0, 0x00, 0x07, 0x80, 0x3f, 0xc1, 0xe0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x80,
+    0xf0, 0x00, 0xf0, 0x00, 0x07, 0x80, 0x3f, 0xc1, 0xe0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x80,
+    0xf0, 0x00, 0xf0, 0x00, 0x07, 0x80, 0x3f, 0xc1, 0xe0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x80,
+    0xf0, 0x00, 0xf0, 0x00, 0x07, 0x80, 0x3f, 0xc1, 0xe0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x80,
+    0x00, 0x00, 0xf0, 0x00, 0x78, 0x03, 0xc3, 0xc1, 0xe0, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x83,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0x03, 0xc0, 0x1f, 0xff, 0xe0, 0x0f, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0xf0, 0x00, 0x78, 0x03, 0xc3, 0xc1, 0xe0, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x83,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0x03, 0xc0, 0x1f, 0xff, 0xe0, 0x0f, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0xf0, 0x00, 0x78, 0x03, 0xc3, 0xc1, 0xe0, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x83,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0x03, 0xc0, 0x1f, 0xff, 0xe0, 0x0f, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0xf0, 0x00, 0x78, 0x03, 0xc3, 0xc1, 0xe0, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x83,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0x03, 0xc0, 0x1f, 0xff, 0xe0, 0x0f, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0xff, 0x00, 0x07, 0xf8, 0x3c, 0x03, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x00, 0x78, 0x00,
+    0x3f, 0xfc, 0x01, 0xff, 0xfe, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x00,
+    0x00, 0xff, 0x00, 0x07, 0xf8, 0x3c, 0x03, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x00, 0x78, 0x00,
+    0x3f, 0xfc, 0x01, 0xff, 0xfe, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x00,
+    0x00, 0xff, 0x00, 0x07, 0xf8, 0x3c, 0x03, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x00, 0x78, 0x00,
+    0x3f, 0xfc, 0x01, 0xff, 0xfe, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x00,
+    0x00, 0xff, 0x00, 0x07, 0xf8, 0x3c, 0x03, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x00, 0x78, 0x00,
+    0x3f, 0xfc, 0x01, 0xff, 0xfe, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xff, 0xfc, 0x00, 0x01, 0xef, 0x00, 0x0f, 0x07, 0x80, 0x03,
+    0xc0, 0x03, 0xc0, 0x00, 0x1e, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x07, 0x80, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xff, 0xfc, 0x00, 0x01, 0xef, 0x00, 0x0f, 0x07, 0x80, 0x03,
+    0xc0, 0x03, 0xc0, 0x00, 0x1e, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x07, 0x80, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xff, 0xfc, 0x00, 0x01, 0xef, 0x00, 0x0f, 0x07, 0x80, 0x03,
+    0xc0, 0x03, 0xc0, 0x00, 0x1e, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x07, 0x80, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xff, 0xfc, 0x00, 0x01, 0xef, 0x00, 0x0f, 0x07, 0x80, 0x03,
+    0xc0, 0x03, 0xc0, 0x00, 0x1e, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x07, 0x80, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0x80, 0x03, 0xc1, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x07, 0x80, 0x03,
+    0xc0, 0x03, 0xc0, 0x01, 0xe0, 0xf7, 0x80, 0x3c, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0x80, 0x03, 0xc1, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x07, 0x80, 0x03,
+    0xc0, 0x03, 0xc0, 0x01, 0xe0, 0xf7, 0x80, 0x3c, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0x80, 0x03, 0xc1, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x07, 0x80, 0x03,
+    0xc0, 0x03, 0xc0, 0x01, 0xe0, 0xf7, 0x80, 0x3c, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0x80, 0x03, 0xc1, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x07, 0x80, 0x03,
+    0xc0, 0x03, 0xc0, 0x01, 0xe0, 0xf7, 0x80, 0x3c, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xf0, 0x7f, 0xf8, 0x00, 0x03, 0xc0, 0x1f, 0xfe, 0x00, 0xff, 0xf0, 0x07, 0x80, 0x00,
+    0x3f, 0xfc, 0x1f, 0xfe, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0xff, 0xff, 0xf0, 0x7f, 0xf8, 0x00, 0x03, 0xc0, 0x1f, 0xfe, 0x00, 0xff, 0xf0, 0x07, 0x80, 0x00,
+    0x3f, 0xfc, 0x1f, 0xfe, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0xff, 0xff, 0xf0, 0x7f, 0xf8, 0x00, 0x03, 0xc0, 0x1f, 0xfe, 0x00, 0xff, 0xf0, 0x07, 0x80, 0x00,
+    0x3f, 0xfc, 0x1f, 0xfe, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0xff, 0xff, 0xf0, 0x7f, 0xf8, 0x00, 0x03, 0xc0, 0x1f, 0xfe, 0x00, 0xff, 0xf0, 0x07, 0x80, 0x00,
+    0x3f, 0xfc, 0x1f, 0xfe, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0xff, 0x00, 0x07, 0x80, 0x3f, 0xff, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x7f, 0xff, 0xfb,
+    0xff, 0xff, 0xc1, 0xff, 0xe0, 0xf0, 0x00, 0xf7, 0xff, 0x80, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0x0f, 0xff, 0x00, 0x07, 0x80, 0x3f, 0xff, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x7f, 0xff, 0xfb,
+    0xff, 0xff, 0xc1, 0xff, 0xe0, 0xf0, 0x00, 0xf7, 0xff, 0x80, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0x0f, 0xff, 0x00, 0x07, 0x80, 0x3f, 0xff, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x7f, 0xff, 0xfb,
+    0xff, 0xff, 0xc1, 0xff, 0xe0, 0xf0, 0x00, 0xf7, 0xff, 0x80, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0x0f, 0xff, 0x00, 0x07, 0x80, 0x3f, 0xff, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x7f, 0xff, 0xfb,
+    0xff, 0xff, 0xc1, 0xff, 0xe0, 0xf0, 0x00, 0xf7, 0xff, 0x80, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0xf0, 0x00, 0xf0, 0x78, 0x78, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe0, 0x1e, 0x00, 0x00,
+    0xf0, 0x00, 0xf0, 0x78, 0x78, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe0, 0x1e, 0x00, 0x00,
+    0xf0, 0x00, 0xf0, 0x78, 0x78, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe0, 0x1e, 0x00, 0x00,
+    0xf0, 0x00, 0xf0, 0x78, 0x78, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe0, 0x1e, 0x00, 0x00,
+    0xf0, 0xf0, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe1, 0xe0, 0x00, 0x00,
+    0xf0, 0xf0, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe1, 0xe0, 0x00, 0x00,
+    0xf0, 0xf0, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe1, 0xe0, 0x00, 0x00,
+    0xf0, 0xf0, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe1, 0xe0, 0x00, 0x00,
+    0xff, 0x0f, 0xf7, 0x80, 0x07, 0xbf, 0xff, 0xc1, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x7f, 0xff, 0x83,
+    0xff, 0xfc, 0x1e, 0x1f, 0xfe, 0xff, 0xff, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xfe, 0x00, 0x00, 0x00,
+    0xff, 0x0f, 0xf7, 0x80, 0x07, 0xbf, 0xff, 0xc1, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x7f, 0xff, 0x83,
+    0xff, 0xfc, 0x1e, 0x1f, 0xfe, 0xff, 0xff, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xfe, 0x00, 0x00, 0x00,
+    0xff, 0x0f, 0xf7, 0x80, 0x07, 0xbf, 0xff, 0xc1, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x7f, 0xff, 0x83,
+    0xff, 0xfc, 0x1e, 0x1f, 0xfe, 0xff, 0xff, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xfe, 0x00, 0x00, 0x00,
+    0xff, 0x0f, 0xf7, 0x80, 0x07, 0xbf, 0xff, 0xc1, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x7f, 0xff, 0x83,
+    0xff, 0xfc, 0x1e, 0x1f, 0xfe, 0xff, 0xff, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xfe, 0x00, 0x00, 0x00,
+    0xf0, 0xf0, 0x07, 0xff, 0xff, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe1, 0xe0, 0x00, 0x00,
+    0xf0, 0xf0, 0x07, 0xff, 0xff, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe1, 0xe0, 0x00, 0x00,
+    0xf0, 0xf0, 0x07, 0xff, 0xff, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe1, 0xe0, 0x00, 0x00,
+    0xf0, 0xf0, 0x07, 0xff, 0xff, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3d, 0xe1, 0xe0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x3c, 0x00, 0x3d, 0xe0, 0x1e, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x3c, 0x00, 0x3d, 0xe0, 0x1e, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x3c, 0x00, 0x3d, 0xe0, 0x1e, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x03,
+    0xc0, 0x00, 0x1e, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x78, 0x3c, 0x00, 0x3d, 0xe0, 0x1e, 0x00, 0x00,
+    0x0f, 0xff, 0x07, 0x80, 0x07, 0xbf, 0xff, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x7f, 0xff, 0xfb,
+    0xc0, 0x00, 0x01, 0xff, 0xe0, 0xf0, 0x00, 0xf7, 0xff, 0x83, 0xff, 0xc1, 0xe0, 0x01, 0xe0, 0x00,
+    0x0f, 0xff, 0x07, 0x80, 0x07, 0xbf, 0xff, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x7f, 0xff, 0xfb,
+    0xc0, 0x00, 0x01, 0xff, 0xe0, 0xf0, 0x00, 0xf7, 0xff, 0x83, 0xff, 0xc1, 0xe0, 0x01, 0xe0, 0x00,
+    0x0f, 0xff, 0x07, 0x80, 0x07, 0xbf, 0xff, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x7f, 0xff, 0xfb,
+    0xc0, 0x00, 0x01, 0xff, 0xe0, 0xf0, 0x00, 0xf7, 0xff, 0x83, 0xff, 0xc1, 0xe0, 0x01, 0xe0, 0x00,
+    0x0f, 0xff, 0x07, 0x80, 0x07, 0xbf, 0xff, 0xc0, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x7f, 0xff, 0xfb,
+    0xc0, 0x00, 0x01, 0xff, 0xe0, 0xf0, 0x00, 0xf7, 0xff, 0x83, 0xff, 0xc1, 0xe0, 0x01, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x07, 0xff, 0x83,
+    0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x07, 0xff, 0x83,
+    0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x07, 0xff, 0x83,
+    0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x1f, 0xfe, 0x0f, 0xff, 0xf0, 0x07, 0xff, 0x83,
+    0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0xf8, 0x7f, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0xf8, 0x7f, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0xf8, 0x7f, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0xf8, 0x7f, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0x87, 0x87, 0xbf, 0xc0, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0x87, 0x87, 0xbf, 0xc0, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0x87, 0x87, 0xbf, 0xc0, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0x87, 0x87, 0xbf, 0xc0, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0,
+    0xf0, 0x00, 0x07, 0x87, 0x87, 0xbc, 0x3c, 0x3d, 0xe0, 0x01, 0xef, 0xff, 0xf0, 0x78, 0x00, 0x7b,
+    0xff, 0xfc, 0x01, 0xff, 0xe0, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe1, 0xe1, 0xe0,
+    0xf0, 0x00, 0x07, 0x87, 0x87, 0xbc, 0x3c, 0x3d, 0xe0, 0x01, 0xef, 0xff, 0xf0, 0x78, 0x00, 0x7b,
+    0xff, 0xfc, 0x01, 0xff, 0xe0, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe1, 0xe1, 0xe0,
+    0xf0, 0x00, 0x07, 0x87, 0x87, 0xbc, 0x3c, 0x3d, 0xe0, 0x01, 0xef, 0xff, 0xf0, 0x78, 0x00, 0x7b,
+    0xff, 0xfc, 0x01, 0xff, 0xe0, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe1, 0xe1, 0xe0,
+    0xf0, 0x00, 0x07, 0x87, 0x87, 0xbc, 0x3c, 0x3d, 0xe0, 0x01, 0xef, 0xff, 0xf0, 0x78, 0x00, 0x7b,
+    0xff, 0xfc, 0x01, 0xff, 0xe0, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe1, 0xe1, 0xe0,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x03, 0xfd, 0xe0, 0x01, 0xef, 0x00, 0x00, 0x78, 0x78, 0x7b,
+    0xc3, 0xc0, 0x00, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe1, 0xe1, 0xe0,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x03, 0xfd, 0xe0, 0x01, 0xef, 0x00, 0x00, 0x78, 0x78, 0x7b,
+    0xc3, 0xc0, 0x00, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe1, 0xe1, 0xe0,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x03, 0xfd, 0xe0, 0x01, 0xef, 0x00, 0x00, 0x78, 0x78, 0x7b,
+    0xc3, 0xc0, 0x00, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe1, 0xe1, 0xe0,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x03, 0xfd, 0xe0, 0x01, 0xef, 0x00, 0x00, 0x78, 0x78, 0x7b,
+    0xc3, 0xc0, 0x00, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe1, 0xe1, 0xe0,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x00, 0x78, 0x07, 0xfb,
+    0xc0, 0x3c, 0x1e, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x83, 0xc3, 0xc1, 0xfe, 0x1f, 0xe0,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x00, 0x78, 0x07, 0xfb,
+    0xc0, 0x3c, 0x1e, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x83, 0xc3, 0xc1, 0xfe, 0x1f, 0xe0,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x00, 0x78, 0x07, 0xfb,
+    0xc0, 0x3c, 0x1e, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x83, 0xc3, 0xc1, 0xfe, 0x1f, 0xe0,
+    0xf0, 0x00, 0x07, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xef, 0x00, 0x00, 0x78, 0x07, 0xfb,
+    0xc0, 0x3c, 0x1e, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x07, 0x83, 0xc3, 0xc1, 0xfe, 0x1f, 0xe0,
+    0xff, 0xff, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x1f, 0xfe, 0x0f, 0x00, 0x00, 0x07, 0xff, 0xfb,
+    0xc0, 0x03, 0xc1, 0xff, 0xe0, 0x00, 0xf0, 0x00, 0x7f, 0xf8, 0x00, 0x3c, 0x01, 0xe0, 0x01, 0xe0,
+    0xff, 0xff, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x1f, 0xfe, 0x0f, 0x00, 0x00, 0x07, 0xff, 0xfb,
+    0xc0, 0x03, 0xc1, 0xff, 0xe0, 0x00, 0xf0, 0x00, 0x7f, 0xf8, 0x00, 0x3c, 0x01, 0xe0, 0x01, 0xe0,
+    0xff, 0xff, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x1f, 0xfe, 0x0f, 0x00, 0x00, 0x07, 0xff, 0xfb,
+    0xc0, 0x03, 0xc1, 0xff, 0xe0, 0x00, 0xf0, 0x00, 0x7f, 0xf8, 0x00, 0x3c, 0x01, 0xe0, 0x01, 0xe0,
+    0xff, 0xff, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x1f, 0xfe, 0x0f, 0x00, 0x00, 0x07, 0xff, 0xfb,
+    0xc0, 0x03, 0xc1, 0xff, 0xe0, 0x00, 0xf0, 0x00, 0x7f, 0xf8, 0x00, 0x3c, 0x01, 0xe0, 0x01, 0xe0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbf, 0xff, 0xfc, 0x1f, 0xef, 0x00, 0x7f, 0x80, 0x03, 0xc0, 0x1f,
+    0xff, 0xfe, 0xf0, 0x00, 0x78, 0x03, 0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbf, 0xff, 0xfc, 0x1f, 0xef, 0x00, 0x7f, 0x80, 0x03, 0xc0, 0x1f,
+    0xff, 0xfe, 0xf0, 0x00, 0x78, 0x03, 0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbf, 0xff, 0xfc, 0x1f, 0xef, 0x00, 0x7f, 0x80, 0x03, 0xc0, 0x1f,
+    0xff, 0xfe, 0xf0, 0x00, 0x78, 0x03, 0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbf, 0xff, 0xfc, 0x1f, 0xef, 0x00, 0x7f, 0x80, 0x03, 0xc0, 0x1f,
+    0xff, 0xfe, 0xf0, 0x00, 0x78, 0x03, 0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0x80, 0x00, 0x3d, 0xe0, 0x0f, 0x00, 0x00, 0x78, 0x3c, 0x3c, 0x00,
+    0x00, 0x00, 0x0f, 0x07, 0x87, 0x83, 0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0x80, 0x00, 0x3d, 0xe0, 0x0f, 0x00, 0x00, 0x78, 0x3c, 0x3c, 0x00,
+    0x00, 0x00, 0x0f, 0x07, 0x87, 0x83, 0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0x80, 0x00, 0x3d, 0xe0, 0x0f, 0x00, 0x00, 0x78, 0x3c, 0x3c, 0x00,
+    0x00, 0x00, 0x0f, 0x07, 0x87, 0x83, 0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0x80, 0x00, 0x3d, 0xe0, 0x0f, 0x00, 0x00, 0x78, 0x3c, 0x3c, 0x00,
+    0x00, 0x00, 0x0f, 0x07, 0x87, 0x83, 0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x78, 0x78, 0x00, 0x03, 0xc1, 0xe0, 0x00, 0xf0, 0x00, 0x7b, 0xc0, 0x03, 0xc0,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xc0, 0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x78, 0x78, 0x00, 0x03, 0xc1, 0xe0, 0x00, 0xf0, 0x00, 0x7b, 0xc0, 0x03, 0xc0,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xc0, 0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x78, 0x78, 0x00, 0x03, 0xc1, 0xe0, 0x00, 0xf0, 0x00, 0x7b, 0xc0, 0x03, 0xc0,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xc0, 0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x78, 0x78, 0x00, 0x03, 0xc1, 0xe0, 0x00, 0xf0, 0x00, 0x7b, 0xc0, 0x03, 0xc0,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xc0, 0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x00, 0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x01, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xff, 0xfc, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x00, 0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x01, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xff, 0xfc, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x00, 0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x01, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xff, 0xfc, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x00, 0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x01, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xff, 0xfc, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7f, 0xff, 0xfb, 0xc0, 0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7f, 0xff, 0xfb, 0xc0, 0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7f, 0xff, 0xfb, 0xc0, 0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7f, 0xff, 0xfb, 0xc0, 0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf0, 0x07, 0x80, 0x3c, 0x00, 0x01, 0xe0, 0x00, 0x0f, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf0, 0x07, 0x80, 0x3c, 0x00, 0x01, 0xe0, 0x00, 0x0f, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf0, 0x07, 0x80, 0x3c, 0x00, 0x01, 0xe0, 0x00, 0x0f, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf0, 0x07, 0x80, 0x3c, 0x00, 0x01, 0xe0, 0x00, 0x0f, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf0, 0x07, 0x80, 0x3f, 0xff, 0xfc, 0x1f, 0xe0, 0x0f, 0x7f, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0xf0, 0x07, 0x80, 0x3f, 0xff, 0xfc, 0x1f, 0xe0, 0x0f, 0x7f, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0xf0, 0x07, 0x80, 0x3f, 0xff, 0xfc, 0x1f, 0xe0, 0x0f, 0x7f, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0xf0, 0x07, 0x80, 0x3f, 0xff, 0xfc, 0x1f, 0xe0, 0x0f, 0x7f, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x7b, 0xff, 0xfc, 0x01, 0xff, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xf7, 0xff, 0xff, 0x83, 0xff, 0xc1, 0xe0, 0x01, 0xef, 0xff, 0x00, 0x00, 0x7b, 0xc0,
+    0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc1, 0xff, 0xfe, 0x00, 0x00,
+    0xff, 0xff, 0xf7, 0xff, 0xff, 0x83, 0xff, 0xc1, 0xe0, 0x01, 0xef, 0xff, 0x00, 0x00, 0x7b, 0xc0,
+    0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc1, 0xff, 0xfe, 0x00, 0x00,
+    0xff, 0xff, 0xf7, 0xff, 0xff, 0x83, 0xff, 0xc1, 0xe0, 0x01, 0xef, 0xff, 0x00, 0x00, 0x7b, 0xc0,
+    0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc1, 0xff, 0xfe, 0x00, 0x00,
+    0xff, 0xff, 0xf7, 0xff, 0xff, 0x83, 0xff, 0xc1, 0xe0, 0x01, 0xef, 0xff, 0x00, 0x00, 0x7b, 0xc0,
+    0x03, 0xde, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc1, 0xff, 0xfe, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc0,
+    0x3c, 0x1e, 0x00, 0x00, 0xff, 0x0f, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc0,
+    0x3c, 0x1e, 0x00, 0x00, 0xff, 0x0f, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc0,
+    0x3c, 0x1e, 0x00, 0x00, 0xff, 0x0f, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc0,
+    0x3c, 0x1e, 0x00, 0x00, 0xff, 0x0f, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x01, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc3,
+    0xc0, 0x1e, 0x00, 0x00, 0xf0, 0xf0, 0xf7, 0xf8, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x01, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc3,
+    0xc0, 0x1e, 0x00, 0x00, 0xf0, 0xf0, 0xf7, 0xf8, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x01, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc3,
+    0xc0, 0x1e, 0x00, 0x00, 0xf0, 0xf0, 0xf7, 0xf8, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x01, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc3,
+    0xc0, 0x1e, 0x00, 0x00, 0xf0, 0xf0, 0xf7, 0xf8, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0x00,
+    0xff, 0xff, 0x07, 0xff, 0xf8, 0x3c, 0x3f, 0xfd, 0xff, 0xff, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xfc,
+    0x00, 0x1e, 0x00, 0x00, 0xf0, 0xf0, 0xf7, 0x87, 0x87, 0xbc, 0x00, 0x3d, 0xff, 0xfe, 0x00, 0x00,
+    0xff, 0xff, 0x07, 0xff, 0xf8, 0x3c, 0x3f, 0xfd, 0xff, 0xff, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xfc,
+    0x00, 0x1e, 0x00, 0x00, 0xf0, 0xf0, 0xf7, 0x87, 0x87, 0xbc, 0x00, 0x3d, 0xff, 0xfe, 0x00, 0x00,
+    0xff, 0xff, 0x07, 0xff, 0xf8, 0x3c, 0x3f, 0xfd, 0xff, 0xff, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xfc,
+    0x00, 0x1e, 0x00, 0x00, 0xf0, 0xf0, 0xf7, 0x87, 0x87, 0xbc, 0x00, 0x3d, 0xff, 0xfe, 0x00, 0x00,
+    0xff, 0xff, 0x07, 0xff, 0xf8, 0x3c, 0x3f, 0xfd, 0xff, 0xff, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xfc,
+    0x00, 0x1e, 0x00, 0x00, 0xf0, 0xf0, 0xf7, 0x87, 0x87, 0xbc, 0x00, 0x3d, 0xff, 0xfe, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc3,
+    0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x7f, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc3,
+    0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x7f, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc3,
+    0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x7f, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x00, 0x00, 0x7b, 0xc3,
+    0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x7f, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x78, 0x00, 0x7b, 0xc0,
+    0x3c, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x78, 0x00, 0x7b, 0xc0,
+    0x3c, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x78, 0x00, 0x7b, 0xc0,
+    0x3c, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 0x00, 0x3d, 0xe0, 0x01, 0xe0, 0xf0, 0x78, 0x00, 0x7b, 0xc0,
+    0x3c, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3d, 0xe0, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xf7, 0x80, 0x00, 0x03, 0xff, 0xc1, 0xe0, 0x01, 0xef, 0xff, 0x07, 0xff, 0x83, 0xc0,
+    0x03, 0xdf, 0xff, 0xfe, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc1, 0xe0, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xf7, 0x80, 0x00, 0x03, 0xff, 0xc1, 0xe0, 0x01, 0xef, 0xff, 0x07, 0xff, 0x83, 0xc0,
+    0x03, 0xdf, 0xff, 0xfe, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc1, 0xe0, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xf7, 0x80, 0x00, 0x03, 0xff, 0xc1, 0xe0, 0x01, 0xef, 0xff, 0x07, 0xff, 0x83, 0xc0,
+    0x03, 0xdf, 0xff, 0xfe, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc1, 0xe0, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xf7, 0x80, 0x00, 0x03, 0xff, 0xc1, 0xe0, 0x01, 0xef, 0xff, 0x07, 0xff, 0x83, 0xc0,
+    0x03, 0xdf, 0xff, 0xfe, 0xf0, 0x00, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc1, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0xff, 0x07, 0xff, 0xf8, 0x03, 0xff, 0xc1, 0xff, 0xff, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf7, 0xff, 0xff, 0x80, 0x3d, 0xef, 0x00, 0x00, 0x00,
+    0x0f, 0xff, 0x07, 0xff, 0xf8, 0x03, 0xff, 0xc1, 0xff, 0xff, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf7, 0xff, 0xff, 0x80, 0x3d, 0xef, 0x00, 0x00, 0x00,
+    0x0f, 0xff, 0x07, 0xff, 0xf8, 0x03, 0xff, 0xc1, 0xff, 0xff, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf7, 0xff, 0xff, 0x80, 0x3d, 0xef, 0x00, 0x00, 0x00,
+    0x0f, 0xff, 0x07, 0xff, 0xf8, 0x03, 0xff, 0xc1, 0xff, 0xff, 0xef, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf7, 0xff, 0xff, 0x80, 0x3d, 0xef, 0x00, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x07, 0x83, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x07, 0x83, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x07, 0x83, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0x07, 0x83, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x00, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xc1, 0xe1, 0xe0, 0x0f, 0x0f, 0x00, 0x00, 0x78, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x00, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xc1, 0xe1, 0xe0, 0x0f, 0x0f, 0x00, 0x00, 0x78, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x00, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xc1, 0xe1, 0xe0, 0x0f, 0x0f, 0x00, 0x00, 0x78, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0x80, 0x07, 0xbc, 0x00, 0x00, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc0, 0x03, 0xc1, 0xe1, 0xe0, 0x0f, 0x0f, 0x00, 0x00, 0x78, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0xff, 0xf8, 0x03, 0xff, 0xc0, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc3, 0xc3, 0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0x07, 0x80, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0xff, 0xf8, 0x03, 0xff, 0xc0, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc3, 0xc3, 0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0x07, 0x80, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0xff, 0xf8, 0x03, 0xff, 0xc0, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc3, 0xc3, 0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0x07, 0x80, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x00,
+    0xf0, 0x00, 0xf7, 0xff, 0xf8, 0x03, 0xff, 0xc0, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc3, 0xc3, 0xc0, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0x07, 0x80, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x00,
+    0xf0, 0xf0, 0xf7, 0x87, 0x80, 0x00, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc3, 0xc3, 0xc1, 0xe1, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0xf0, 0xf7, 0x87, 0x80, 0x00, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc3, 0xc3, 0xc1, 0xe1, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0xf0, 0xf7, 0x87, 0x80, 0x00, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc3, 0xc3, 0xc1, 0xe1, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0xf0, 0xf7, 0x87, 0x80, 0x00, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x78, 0x00, 0x7b,
+    0xc3, 0xc3, 0xc1, 0xe1, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x0f, 0xf7, 0x80, 0x78, 0x3c, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x07, 0x87, 0x83,
+    0xfc, 0x3f, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x00, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x0f, 0xf7, 0x80, 0x78, 0x3c, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x07, 0x87, 0x83,
+    0xfc, 0x3f, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x00, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x0f, 0xf7, 0x80, 0x78, 0x3c, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x07, 0x87, 0x83,
+    0xfc, 0x3f, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x00, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0xf0, 0x0f, 0xf7, 0x80, 0x78, 0x3c, 0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x07, 0x87, 0x83,
+    0xfc, 0x3f, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x00, 0x03, 0xc1, 0xe0, 0xf0, 0x00, 0x00,
+    0x0f, 0xff, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc0, 0x01, 0xe0, 0x00, 0xff, 0xf0, 0x00, 0x78, 0x03,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0xff, 0xff, 0x80, 0x3d, 0xef, 0x00, 0x00, 0x00,
+    0x0f, 0xff, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc0, 0x01, 0xe0, 0x00, 0xff, 0xf0, 0x00, 0x78, 0x03,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0xff, 0xff, 0x80, 0x3d, 0xef, 0x00, 0x00, 0x00,
+    0x0f, 0xff, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc0, 0x01, 0xe0, 0x00, 0xff, 0xf0, 0x00, 0x78, 0x03,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0xff, 0xff, 0x80, 0x3d, 0xef, 0x00, 0x00, 0x00,
+    0x0f, 0xff, 0xf7, 0x80, 0x07, 0x83, 0xff, 0xc0, 0x01, 0xe0, 0x00, 0xff, 0xf0, 0x00, 0x78, 0x03,
+    0xc0, 0x03, 0xde, 0x00, 0x1e, 0x00, 0xf0, 0x07, 0xff, 0xff, 0x80, 0x3d, 0xef, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// The font file, for text the atlas cannot draw
+static const uchar FONT_TTF_DATA[19380] =
+{
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x80, 0x00, 0x03, 0x00, 0x20, 0x4f, 0x53, 0x2f, 0x32,
+    0x04, 0x96, 0x06, 0xda, 0x00, 0x00, 0x0e, 0x1c, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
+    0x59, 0xf5, 0x54, 0x9e, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x03, 0x8c, 0x67, 0x6c, 0x79, 0x66,
+    0x1d, 0x2f, 0x1c, 0xf0, 0x00, 0x00, 0x0e, 0x9c, 0x00, 0x00, 0x3a, 0xd8, 0x68, 0x65, 0x61, 0x64,
+    0x5f, 0x10, 0xff, 0x90, 0x00, 0x00, 0x04, 0x38, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+    0x04, 0x00, 0xfd, 0x7d, 0x00, 0x00, 0x04, 0x70, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+    0x49, 0x80, 0x02, 0x34, 0x00, 0x00, 0x04, 0x94, 0x00, 0x00, 0x02, 0x3c, 0x6c, 0x6f, 0x63, 0x61,
+    0x00, 0x00, 0xdd, 0x0b, 0x00, 0x00, 0x49, 0x74, 0x00, 0x00, 0x02, 0x40, 0x6d, 0x61, 0x78, 0x70,
+    0xff, 0x90, 0x00, 0x9c, 0x00, 0x00, 0x06, 0xd0, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+    0x5a, 0x21, 0xed, 0xf8, 0x00, 0x00, 0x06, 0xf0, 0x00, 0x00, 0x07, 0x2c, 0x70, 0x6f, 0x73, 0x74,
+    0x00, 0x02, 0xff, 0xfd, 0x00, 0x00, 0x0e, 0x7c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0xd0,
+    0x00, 0x04, 0x01, 0xbc, 0x00, 0x00, 0x00, 0x24, 0x00, 0x20, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x0d, 0x00, 0x7e, 0x00, 0xaa, 0x00, 0xba, 0x00, 0xbf, 0x00, 0xd7, 0x00, 0xde, 0x00, 0xf7,
+    0x00, 0xfe, 0x20, 0x14, 0x20, 0x1e, 0x20, 0x20, 0x20, 0x26, 0x20, 0x3a, 0x20, 0xac, 0xfb, 0x02,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xbf,
+    0x00, 0xd7, 0x00, 0xde, 0x00, 0xf7, 0x00, 0xfe, 0x20, 0x14, 0x20, 0x18, 0x20, 0x20, 0x20, 0x26,
+    0x20, 0x39, 0x20, 0xac, 0xfb, 0x01, 0xff, 0xff, 0x00, 0x01, 0xff, 0xf5, 0xff, 0xe3, 0xff, 0xc1,
+    0xff, 0xc0, 0xff, 0xbc, 0xff, 0xa5, 0xff, 0x9f, 0xff, 0x87, 0xff, 0x81, 0xe0, 0x6c, 0xe0, 0x69,
+    0xe0, 0x68, 0xe0, 0x63, 0xe0, 0x51, 0xdf, 0xe0, 0x05, 0x8c, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xbc,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x20, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x7e,
+    0x00, 0xaa, 0x00, 0xba, 0x00, 0xbf, 0x00, 0xd7, 0x00, 0xde, 0x00, 0xf7, 0x00, 0xfe, 0x20, 0x14,
+    0x20, 0x1e, 0x20, 0x20, 0x20, 0x26, 0x20, 0x3a, 0x20, 0xac, 0xfb, 0x02, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0xa1, 0x00, 0xac, 0x00, 0xbf, 0x00, 0xd7, 0x00, 0xde,
+    0x00, 0xf7, 0x00, 0xfe, 0x20, 0x14, 0x20, 0x18, 0x20, 0x20, 0x20, 0x26, 0x20, 0x39, 0x20, 0xac,
+    0xfb, 0x01, 0xff, 0xff, 0x00, 0x01, 0xff, 0xf5, 0xff, 0xe3, 0xff, 0xc1, 0xff, 0xc0, 0xff, 0xbc,
+    0xff, 0xa5, 0xff, 0x9f, 0xff, 0x87, 0xff, 0x81, 0xe0, 0x6c, 0xe0, 0x69, 0xe0, 0x68, 0xe0, 0x63,
+    0xe0, 0x51, 0xdf, 0xe0, 0x05, 0x8c, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0xd6, 0xf8, 0xf8, 0xce, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc8, 0x80, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x80, 0xff, 0x9f, 0x00, 0x00, 0xfe, 0x80,
+    0x03, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x03, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x2c, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x01, 0x9e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x16,
+    0x00, 0x46, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x5c, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x67, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x3c, 0x00, 0x75, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1e,
+    0x00, 0xb1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x00, 0xcf, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x2b, 0x00, 0xd8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x17, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x39,
+    0x01, 0x1a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x28, 0x01, 0x53, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2e, 0x01, 0x7b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x00, 0x29, 0x01, 0xa9, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08,
+    0x01, 0xd2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0x30, 0x01, 0xda, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x1c, 0x02, 0x0a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x02, 0x00, 0x0e, 0x02, 0x26, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x32,
+    0x02, 0x34, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x2c, 0x02, 0x66, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x16, 0x02, 0x92, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x06, 0x00, 0x1c, 0x02, 0xa8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x07, 0x00, 0x78,
+    0x02, 0xc4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x08, 0x00, 0x3c, 0x03, 0x3c, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x12, 0x03, 0x78, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x0a, 0x00, 0x56, 0x03, 0x8a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0b, 0x00, 0x2e,
+    0x03, 0xe0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0c, 0x00, 0x72, 0x04, 0x0e, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x00, 0x50, 0x04, 0x80, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x0e, 0x00, 0x5c, 0x04, 0xd0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x13, 0x00, 0x52,
+    0x05, 0x2c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x00, 0x00, 0x10, 0x05, 0x7e, 0x43, 0x6f,
+    0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6b, 0x79, 0x6c, 0x65, 0x6d, 0x61, 0x6f, 0x69,
+    0x6e, 0x20, 0x32, 0x30, 0x31, 0x30, 0x53, 0x70, 0x61, 0x63, 0x65, 0x20, 0x49, 0x6e, 0x76, 0x61,
+    0x64, 0x65, 0x72, 0x73, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x46, 0x6f, 0x6e, 0x74, 0x53,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x53, 0x70, 0x61, 0x63, 0x65, 0x20, 0x49, 0x6e, 0x76, 0x61,
+    0x64, 0x65, 0x72, 0x73, 0x53, 0x70, 0x61, 0x63, 0x65, 0x20, 0x49, 0x6e, 0x76, 0x61, 0x64, 0x65,
+    0x72, 0x73, 0x20, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
+    0x6e, 0x20, 0x31, 0x2e, 0x30, 0x53, 0x70, 0x61, 0x63, 0x65, 0x2d, 0x49, 0x6e, 0x76, 0x61, 0x64,
+    0x65, 0x72, 0x73, 0x46, 0x6f, 0x6e, 0x74, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x6f, 0x66, 0x20,
+    0x46, 0x53, 0x49, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x53, 0x68, 0x6f, 0x70, 0x20, 0x49, 0x6e, 0x74,
+    0x65, 0x72, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x47, 0x6d, 0x62, 0x48, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x2e, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x68, 0x6f, 0x70, 0x2e, 0x63, 0x6f, 0x6d, 0x6b, 0x79, 0x6c,
+    0x65, 0x6d, 0x61, 0x6f, 0x69, 0x6e, 0x1c, 0x53, 0x70, 0x61, 0x63, 0x65, 0x20, 0x49, 0x6e, 0x76,
+    0x61, 0x64, 0x65, 0x72, 0x73, 0x1d, 0x20, 0x77, 0x61, 0x73, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x74,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x0a, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x66, 0x6f, 0x6e, 0x74,
+    0x73, 0x68, 0x6f, 0x70, 0x2e, 0x63, 0x6f, 0x6d, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x66,
+    0x6f, 0x6e, 0x74, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2e, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x68,
+    0x6f, 0x70, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2f, 0x73, 0x68, 0x6f, 0x77, 0x2f, 0x32, 0x38, 0x32, 0x37, 0x35,
+    0x31, 0x43, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
+    0x73, 0x20, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 0x68,
+    0x61, 0x72, 0x65, 0x20, 0x41, 0x6c, 0x69, 0x6b, 0x65, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f,
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2e,
+    0x6f, 0x72, 0x67, 0x2f, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x73, 0x2f, 0x62, 0x79, 0x2d,
+    0x73, 0x61, 0x2f, 0x33, 0x2e, 0x30, 0x2f, 0x46, 0x69, 0x76, 0x65, 0x20, 0x62, 0x69, 0x67, 0x20,
+    0x71, 0x75, 0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x7a, 0x65, 0x70, 0x68, 0x79, 0x72, 0x73,
+    0x20, 0x6a, 0x6f, 0x6c, 0x74, 0x20, 0x6d, 0x79, 0x20, 0x77, 0x61, 0x78, 0x20, 0x62, 0x65, 0x64,
+    0x41, 0x41, 0x45, 0x4b, 0x63, 0x6c, 0x78, 0x6c, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79,
+    0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6b, 0x00, 0x79,
+    0x00, 0x6c, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x6f, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20,
+    0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x30, 0x00, 0x53, 0x00, 0x70, 0x00, 0x61, 0x00, 0x63,
+    0x00, 0x65, 0x00, 0x20, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65,
+    0x00, 0x72, 0x00, 0x73, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61,
+    0x00, 0x72, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x53, 0x00, 0x74, 0x00, 0x72,
+    0x00, 0x75, 0x00, 0x63, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x70, 0x00, 0x61, 0x00, 0x63,
+    0x00, 0x65, 0x00, 0x20, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65,
+    0x00, 0x72, 0x00, 0x73, 0x00, 0x53, 0x00, 0x70, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x20,
+    0x00, 0x49, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73,
+    0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72,
+    0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20,
+    0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x53, 0x00, 0x70, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65,
+    0x00, 0x2d, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72,
+    0x00, 0x73, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x53, 0x00, 0x74, 0x00, 0x72,
+    0x00, 0x75, 0x00, 0x63, 0x00, 0x74, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61,
+    0x00, 0x20, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x61,
+    0x00, 0x72, 0x00, 0x6b, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x46, 0x00, 0x53,
+    0x00, 0x49, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x53, 0x00, 0x68,
+    0x00, 0x6f, 0x00, 0x70, 0x00, 0x20, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72,
+    0x00, 0x6e, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6c,
+    0x00, 0x20, 0x00, 0x47, 0x00, 0x6d, 0x00, 0x62, 0x00, 0x48, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74,
+    0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74,
+    0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x75, 0x00, 0x63, 0x00, 0x74, 0x00, 0x2e, 0x00, 0x66,
+    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x2e,
+    0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x6b, 0x00, 0x79, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x6d,
+    0x00, 0x61, 0x00, 0x6f, 0x00, 0x69, 0x00, 0x6e, 0x20, 0x1c, 0x00, 0x53, 0x00, 0x70, 0x00, 0x61,
+    0x00, 0x63, 0x00, 0x65, 0x00, 0x20, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x61, 0x00, 0x64,
+    0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x20, 0x1d, 0x00, 0x20, 0x00, 0x77, 0x00, 0x61, 0x00, 0x73,
+    0x00, 0x20, 0x00, 0x62, 0x00, 0x75, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x20, 0x00, 0x77,
+    0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74,
+    0x00, 0x53, 0x00, 0x74, 0x00, 0x72, 0x00, 0x75, 0x00, 0x63, 0x00, 0x74, 0x00, 0x0a, 0x00, 0x68,
+    0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x77, 0x00, 0x77,
+    0x00, 0x77, 0x00, 0x2e, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x68,
+    0x00, 0x6f, 0x00, 0x70, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x68, 0x00, 0x74,
+    0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e,
+    0x00, 0x74, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x75, 0x00, 0x63, 0x00, 0x74, 0x00, 0x2e,
+    0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x70,
+    0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x2f, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e,
+    0x00, 0x74, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x75, 0x00, 0x63, 0x00, 0x74, 0x00, 0x69,
+    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x2f, 0x00, 0x73, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x77,
+    0x00, 0x2f, 0x00, 0x32, 0x00, 0x38, 0x00, 0x32, 0x00, 0x37, 0x00, 0x35, 0x00, 0x31, 0x00, 0x43,
+    0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20,
+    0x00, 0x43, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x20,
+    0x00, 0x41, 0x00, 0x74, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74,
+    0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x53, 0x00, 0x68, 0x00, 0x61, 0x00, 0x72,
+    0x00, 0x65, 0x00, 0x20, 0x00, 0x41, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x6b, 0x00, 0x65, 0x00, 0x68,
+    0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x63, 0x00, 0x72,
+    0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x63, 0x00, 0x6f,
+    0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72,
+    0x00, 0x67, 0x00, 0x2f, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73,
+    0x00, 0x65, 0x00, 0x73, 0x00, 0x2f, 0x00, 0x62, 0x00, 0x79, 0x00, 0x2d, 0x00, 0x73, 0x00, 0x61,
+    0x00, 0x2f, 0x00, 0x33, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x46, 0x00, 0x69, 0x00, 0x76,
+    0x00, 0x65, 0x00, 0x20, 0x00, 0x62, 0x00, 0x69, 0x00, 0x67, 0x00, 0x20, 0x00, 0x71, 0x00, 0x75,
+    0x00, 0x61, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x7a,
+    0x00, 0x65, 0x00, 0x70, 0x00, 0x68, 0x00, 0x79, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6a,
+    0x00, 0x6f, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x20, 0x00, 0x77,
+    0x00, 0x61, 0x00, 0x78, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x64, 0x00, 0x41, 0x00, 0x41,
+    0x00, 0x45, 0x00, 0x4b, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x6c, 0x00, 0x02, 0x02, 0x76,
+    0x01, 0x90, 0x00, 0x05, 0x00, 0x04, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x33, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x53, 0x54, 0x52, 0x00, 0x40, 0x00, 0x0d, 0xfb, 0x02,
+    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xfb, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x12, 0x00, 0x16,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xc0, 0x00, 0x00, 0xff, 0x71, 0x00,
+    0x00, 0x01, 0x1d, 0x00, 0x00, 0xfe, 0xe3, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0xff, 0x71, 0x00,
+    0x00, 0x01, 0x1d, 0x00, 0x00, 0xff, 0x72, 0xff, 0xc4, 0xff, 0xd7, 0xff, 0xd6, 0x00, 0x00, 0xfe,
+    0xcf, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x8e, 0x00, 0x00, 0xff, 0x72, 0x00,
+    0xa6, 0x00, 0x8f, 0x00, 0x00, 0xff, 0x71, 0x00, 0xa6, 0x00, 0x8f, 0x00, 0x00, 0xff, 0x71, 0x00,
+    0xa7, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0xff, 0xd6, 0xff, 0xc6, 0xfd, 0x8e, 0x03,
+    0x80, 0x00, 0x00, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80,
+    0x00, 0x02, 0x00, 0x00, 0x02, 0x80, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0xfe, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0x80, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0xfd, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x02, 0x00, 0x00, 0x02, 0x80, 0x01, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+    0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x00, 0x0b,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x1b,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xff, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15,
+    0x00, 0x19, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x17, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x80, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x01, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x02, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x03, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x17,
+    0x00, 0x1d, 0x00, 0x21, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xfe, 0x80, 0x02, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x03, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfd, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x02, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0xff, 0x80, 0x03, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x09, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x02, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfc, 0x80, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xfd, 0x80, 0x03, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x03, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0xfe, 0x80, 0x03, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xfd, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xfc, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x0b, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xfe, 0x80, 0x03, 0x80, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80,
+    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0xfe, 0x00, 0x03, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0xff, 0x80, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0xff, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x03, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+    0x00, 0x19, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x03, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
+    0xfd, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x0b, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x80, 0x00, 0x00,
+    0xfd, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+    0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x17,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x02, 0x80, 0x00, 0x00,
+    0xfd, 0x80, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x02, 0x80, 0x00, 0x00,
+    0xfd, 0x80, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x02, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x02, 0x80, 0x01, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x0b,
+    0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfd, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0xfe, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
+    0xfd, 0x80, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x0b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xfe, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80,
+    0xff, 0x80, 0x03, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80,
+    0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0xfc, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xfd, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x1f,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xfd, 0x80, 0x03, 0x80, 0x00, 0x00,
+    0xfe, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x03, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x05,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x13,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x03, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xfe, 0x80,
+    0x03, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfc, 0x80, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+    0x00, 0x0f, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x02, 0x80,
+    0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x02, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x0d, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x03, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x03, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0xfe, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfc, 0x80, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+    0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x02, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d,
+    0x00, 0x11, 0x00, 0x17, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+    0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xfc, 0x80, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+    0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80,
+    0x03, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x04, 0x00, 0x00, 0xff, 0x80, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x02, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0xfd, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x02, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+    0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0xfe, 0x80, 0x02, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x17,
+    0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xfe, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x02, 0x00, 0x00,
+    0x03, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80,
+    0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0x01, 0x00,
+    0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x02, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfd, 0x80, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x01, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x02, 0x80, 0x01, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x03, 0x00, 0x00, 0xff, 0x00, 0x02, 0x80,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0xff, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfc, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x02, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x80, 0x01, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
+    0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0xfe, 0x80, 0x03, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0xfe, 0x80, 0x03, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x80, 0x02, 0x80, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x02, 0x80, 0x00, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x80, 0x00, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x02, 0x80, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x80, 0x01, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xfd, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x02, 0x80, 0x02, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x0d,
+    0x00, 0x13, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0xff, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8c,
+    0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xfc,
+    0x00, 0x00, 0x01, 0xac, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x03, 0x1c, 0x00, 0x00, 0x03, 0xcc,
+    0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x05, 0xc8,
+    0x00, 0x00, 0x06, 0x14, 0x00, 0x00, 0x06, 0x38, 0x00, 0x00, 0x06, 0x5c, 0x00, 0x00, 0x06, 0x80,
+    0x00, 0x00, 0x06, 0xd0, 0x00, 0x00, 0x07, 0x74, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x08, 0x5c,
+    0x00, 0x00, 0x08, 0xec, 0x00, 0x00, 0x09, 0x6c, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x0a, 0x80,
+    0x00, 0x00, 0x0a, 0xf0, 0x00, 0x00, 0x0b, 0x98, 0x00, 0x00, 0x0c, 0x28, 0x00, 0x00, 0x0c, 0x60,
+    0x00, 0x00, 0x0c, 0x98, 0x00, 0x00, 0x0d, 0x40, 0x00, 0x00, 0x0d, 0x78, 0x00, 0x00, 0x0e, 0x20,
+    0x00, 0x00, 0x0e, 0xb0, 0x00, 0x00, 0x0f, 0x74, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x78,
+    0x00, 0x00, 0x10, 0xf4, 0x00, 0x00, 0x11, 0x40, 0x00, 0x00, 0x11, 0x8c, 0x00, 0x00, 0x11, 0xcc,
+    0x00, 0x00, 0x12, 0x50, 0x00, 0x00, 0x12, 0x9c, 0x00, 0x00, 0x12, 0xe8, 0x00, 0x00, 0x13, 0x38,
+    0x00, 0x00, 0x13, 0xf4, 0x00, 0x00, 0x14, 0x20, 0x00, 0x00, 0x14, 0x98, 0x00, 0x00, 0x15, 0x10,
+    0x00, 0x00, 0x15, 0x74, 0x00, 0x00, 0x15, 0xcc, 0x00, 0x00, 0x16, 0x44, 0x00, 0x00, 0x16, 0xdc,
+    0x00, 0x00, 0x17, 0x84, 0x00, 0x00, 0x17, 0xbc, 0x00, 0x00, 0x18, 0x0c, 0x00, 0x00, 0x18, 0x88,
+    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0xd4, 0x00, 0x00, 0x1a, 0x50, 0x00, 0x00, 0x1a, 0xe0,
+    0x00, 0x00, 0x1b, 0x30, 0x00, 0x00, 0x1b, 0x80, 0x00, 0x00, 0x1b, 0xd0, 0x00, 0x00, 0x1c, 0x4c,
+    0x00, 0x00, 0x1c, 0x70, 0x00, 0x00, 0x1c, 0xa8, 0x00, 0x00, 0x1d, 0x34, 0x00, 0x00, 0x1d, 0xac,
+    0x00, 0x00, 0x1e, 0x28, 0x00, 0x00, 0x1e, 0x74, 0x00, 0x00, 0x1e, 0xc0, 0x00, 0x00, 0x1f, 0x00,
+    0x00, 0x00, 0x1f, 0x84, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x20, 0x1c, 0x00, 0x00, 0x20, 0x6c,
+    0x00, 0x00, 0x21, 0x28, 0x00, 0x00, 0x21, 0x54, 0x00, 0x00, 0x21, 0xcc, 0x00, 0x00, 0x22, 0x44,
+    0x00, 0x00, 0x22, 0xa8, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x24, 0x10,
+    0x00, 0x00, 0x24, 0xb8, 0x00, 0x00, 0x24, 0xf0, 0x00, 0x00, 0x25, 0x40, 0x00, 0x00, 0x25, 0xbc,
+    0x00, 0x00, 0x26, 0x34, 0x00, 0x00, 0x27, 0x08, 0x00, 0x00, 0x27, 0x84, 0x00, 0x00, 0x28, 0x14,
+    0x00, 0x00, 0x28, 0x90, 0x00, 0x00, 0x28, 0xb4, 0x00, 0x00, 0x29, 0x30, 0x00, 0x00, 0x29, 0x94,
+    0x00, 0x00, 0x29, 0xcc, 0x00, 0x00, 0x2a, 0x80, 0x00, 0x00, 0x2b, 0x24, 0x00, 0x00, 0x2b, 0xb4,
+    0x00, 0x00, 0x2c, 0x68, 0x00, 0x00, 0x2c, 0xa0, 0x00, 0x00, 0x2d, 0x70, 0x00, 0x00, 0x2d, 0xa8,
+    0x00, 0x00, 0x2e, 0x4c, 0x00, 0x00, 0x2e, 0xb0, 0x00, 0x00, 0x2e, 0xdc, 0x00, 0x00, 0x2f, 0x00,
+    0x00, 0x00, 0x2f, 0xc8, 0x00, 0x00, 0x2f, 0xec, 0x00, 0x00, 0x30, 0x50, 0x00, 0x00, 0x30, 0xb0,
+    0x00, 0x00, 0x31, 0x08, 0x00, 0x00, 0x31, 0x84, 0x00, 0x00, 0x31, 0xbc, 0x00, 0x00, 0x32, 0x34,
+    0x00, 0x00, 0x32, 0x88, 0x00, 0x00, 0x32, 0xac, 0x00, 0x00, 0x32, 0xfc, 0x00, 0x00, 0x33, 0x20,
+    0x00, 0x00, 0x33, 0x9c, 0x00, 0x00, 0x34, 0x2c, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x60,
+    0x00, 0x00, 0x35, 0xb0, 0x00, 0x00, 0x36, 0x10, 0x00, 0x00, 0x36, 0x34, 0x00, 0x00, 0x36, 0x58,
+    0x00, 0x00, 0x36, 0x7c, 0x00, 0x00, 0x36, 0xa0, 0x00, 0x00, 0x36, 0xc4, 0x00, 0x00, 0x36, 0xfc,
+    0x00, 0x00, 0x37, 0x34, 0x00, 0x00, 0x37, 0x6c, 0x00, 0x00, 0x37, 0xb8, 0x00, 0x00, 0x38, 0x08,
+    0x00, 0x00, 0x38, 0xb0, 0x00, 0x00, 0x39, 0x58, 0x00, 0x00, 0x39, 0xf8, 0x00, 0x00, 0x3a, 0x6c,
+    0x00, 0x00, 0x3a, 0xd8,
+};
+
+#endif // !FONTDATA_H
@@ -0,0 +1,203 @@
+#include "framebuffer.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif // __SSE2__
+
+// Internal variables
+static Uint32 * pPixels = NULL;
+static SDL_Surface * pSurface = NULL;
+static SDL_Texture * pTexture = NULL;
+static int width;
+static int height;
+
+// Internal functions
+
+// Divide a 16-bit channel product by 255 with rounding
+static inline Uint32 Div255(Uint32 x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// Fill 'count' pixels with an opaque colour
+// Four pixels are written per SSE2 store, the remainder one by one
+static void FillSpan(Uint32 * pDst, int count, const Uint32 colour)
+{
+#ifdef __SSE2__
+    const __m128i COLOUR = _mm_set1_epi32((int)colour);
+    for(; count >= 4; count -= 4, pDst += 4)
+    {
+        _mm_storeu_si128((__m128i *)pDst, COLOUR);
+    }
+#endif // __SSE2__
+    while(count-- > 0)
+    {
+        *pDst++ = colour;
+    }
+}
+
+// Alpha-blend 'count' pixels with a translucent colour
+// Matches SDL_BLENDMODE_BLEND: dst = src * a + dst * (1 - a)
+static void BlendSpan(Uint32 * pDst, int count, const Uint32 colour)
+{
+    const Uint32 ALPHA     = colour >> 24;
+    const Uint32 INV_ALPHA = 255 - ALPHA;
+
+#ifdef __SSE2__
+    // Channels are widened to 16 bits, two pixels per half register.
+    // The source term is constant, so it is premultiplied once
+    const __m128i ZERO = _mm_setzero_si128();
+    const __m128i INV  = _mm_set1_epi16((short)INV_ALPHA);
+    const __m128i HALF = _mm_set1_epi16(128);
+    const __m128i SRC  = _mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32((int)(colour | 0xFF000000)), ZERO),
+                                         _mm_set1_epi16((short)ALPHA));
+
+    #define DIV_255(v) _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(v, HALF), _mm_srli_epi16(_mm_add_epi16(v, HALF), 8)), 8)
+    for(; count >= 4; count -= 4, pDst += 4)
+    {
+        const __m128i DST = _mm_loadu_si128((const __m128i *)pDst);
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(DST, ZERO), INV), SRC);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(DST, ZERO), INV), SRC);
+        lo = DIV_255(lo);
+        hi = DIV_255(hi);
+        _mm_storeu_si128((__m128i *)pDst, _mm_packus_epi16(lo, hi));
+    }
+    #undef DIV_255
+#endif // __SSE2__
+
+    const Uint32 SRC_R = ((colour >> 16) & 0xFF) * ALPHA;
+    const Uint32 SRC_G = ((colour >> 8) & 0xFF) * ALPHA;
+    const Uint32 SRC_B = (colour & 0xFF) * ALPHA;
+    for(; count > 0; count--, pDst++)
+    {
+        const Uint32 DST = *pDst;
+        *pDst = 0xFF000000
+              | (Div255(SRC_R + ((DST >> 16) & 0xFF) * INV_ALPHA) << 16)
+              | (Div255(SRC_G + ((DST >> 8) & 0xFF) * INV_ALPHA) << 8)
+              | Div255(SRC_B + (DST & 0xFF) * INV_ALPHA);
+    }
+}
+
+// Public functions
+
+// "Constructor"
+// Allocate the pixel buffer and the streaming texture used to upload it
+// Return FALSE if any of the resources cannot be created
+BOOL FramebufferInitialise(SDL_Renderer * pRenderer, const int w, const int h)
+{
+    FramebufferFree();
+
+    width  = w;
+    height = h;
+    pPixels = (Uint32 *)calloc((size_t)w * (size_t)h, sizeof(Uint32));
+    if(!pPixels)
+    {
+        return FALSE;
+    }
+
+    // The surface shares the pixel buffer and is only used
+    // for blitting text surfaces produced by SDL_ttf
+    pSurface = SDL_CreateRGBSurfaceWithFormatFrom(pPixels, w, h, 32, w * (int)sizeof(Uint32), SDL_PIXELFORMAT_ARGB8888);
+    pTexture = SDL_CreateTexture(pRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, w, h);
+    if(!pSurface || !pTexture)
+    {
+        FramebufferFree();
+        return FALSE;
+    }
+    SDL_SetTextureBlendMode(pTexture, SDL_BLENDMODE_NONE);
+    return TRUE;
+}
+
+// "Destructor"
+void FramebufferFree(void)
+{
+    if(pTexture)
+    {
+        SDL_DestroyTexture(pTexture);
+        pTexture = NULL;
+    }
+    if(pSurface)
+    {
+        SDL_FreeSurface(pSurface);
+        pSurface = NULL;
+    }
+    if(pPixels)
+    {
+        free(pPixels);
+        pPixels = NULL;
+    }
+    width  = 0;
+    height = 0;
+}
+
+// Upload the pixel buffer and copy it onto the renderer
+// This is the only point where the GPU (or SDL's own software renderer) is involved
+void FramebufferPresent(SDL_Renderer * pRenderer)
+{
+    SDL_UpdateTexture(pTexture, NULL, pPixels, width * (int)sizeof(Uint32));
+    SDL_RenderCopy(pRenderer, pTexture, NULL, NULL);
+}
+
+// Fill the whole buffer with a single colour
+void FramebufferClear(const Uint32 colour)
+{
+    FillSpan(pPixels, width * height, colour | 0xFF000000);
+}
+
+// Fill a rectangle, clipped to the buffer
+// Opaque colours are written directly, translucent ones are blended
+void FramebufferFillRect(const SDL_Rect * pRect, const Uint32 colour)
+{
+    const int X0 = (pRect->x < 0) ? 0 : pRect->x;
+    const int Y0 = (pRect->y < 0) ? 0 : pRect->y;
+    const int X1 = (pRect->x + pRect->w > width) ? width : pRect->x + pRect->w;
+    const int Y1 = (pRect->y + pRect->h > height) ? height : pRect->y + pRect->h;
+    if(X0 >= X1 || Y0 >= Y1)
+    {
+        return;
+    }
+
+    const uchar ALPHA = colour >> 24;
+    if(ALPHA == 0)
+    {
+        return;
+    }
+
+    Uint32 * pRow = pPixels + (Y0 * width) + X0;
+    for(int y = Y0; y < Y1; y++, pRow += width)
+    {
+        if(ALPHA == SDL_ALPHA_OPAQUE)
+        {
+            FillSpan(pRow, X1 - X0, colour);
+        }
+        else
+        {
+            BlendSpan(pRow, X1 - X0, colour);
+        }
+    }
+}
+
+// Scale and copy a surface into the buffer
+// Surface colour key (used by solid text) is respected
+void FramebufferBlitSurface(SDL_Surface * pSource, SDL_Rect * pRect)
+{
+    // SDL clips the destination rectangle in place, so use a copy
+    SDL_Rect r = *pRect;
+    SDL_BlitScaled(pSource, NULL, pSurface, &r);
+}
+
+// Copy part of a surface into the buffer, scaled to the destination rectangle
+void FramebufferBlitSurfaceRect(SDL_Surface * pSource, const SDL_Rect * pSourceRect, const SDL_Rect * pRect)
+{
+    SDL_Rect source = *pSourceRect;
+    SDL_Rect r = *pRect;
+    SDL_BlitScaled(pSource, &source, pSurface, &r);
+}
+
+// Return the buffer size
+void FramebufferGetSize(int * pW, int * pH)
+{
+    *pW = width;
+    *pH = height;
+}
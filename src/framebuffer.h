@@ -0,0 +1,32 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <SDL2/SDL.h>
+
+#include "types.h"
+
+// Software rendering target
+// All drawing is done into a CPU-side ARGB8888 pixel buffer
+// which is uploaded to the screen with a single texture update per frame
+
+// Main functions
+BOOL FramebufferInitialise(SDL_Renderer * pRenderer, const int w, const int h);
+void FramebufferFree(void);
+void FramebufferPresent(SDL_Renderer * pRenderer);
+
+// Drawing functions
+void FramebufferClear(const Uint32 colour);
+void FramebufferFillRect(const SDL_Rect * pRect, const Uint32 colour);
+void FramebufferBlitSurface(SDL_Surface * pSurface, SDL_Rect * pRect);
+void FramebufferBlitSurfaceRect(SDL_Surface * pSurface, const SDL_Rect * pSourceRect, const SDL_Rect * pRect);
+
+// Helper functions
+void FramebufferGetSize(int * pW, int * pH);
+
+// Pack colour components into a single ARGB8888 pixel
+static inline Uint32 FramebufferMakeColour(const uchar r, const uchar g, const uchar b, const uchar a)
+{
+    return ((Uint32)a << 24) | ((Uint32)r << 16) | ((Uint32)g << 8) | (Uint32)b;
+}
+
+#endif // !FRAMEBUFFER_H
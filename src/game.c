@@ -5,38 +5,109 @@
 
 #include "types.h"
 #include "snake.h"
+#include "snakecache.h"
+#include "snakegrid.h"
+#include "snakemesh.h"
 #include "menu.h"
+#include "simulation.h"
+#include "simthread.h"
+#include "snapshot.h"
+#include "archive.h"
+#include "eventlog.h"
+#include "spectator.h"
+#include "latency.h"
+#include "particles.h"
+#include "camera.h"
+#include "alloctrack.h"
+#include "trace.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <SDL2/SDL_keyboard.h>
 
-// Inspired by the old Nokia snake
-// In order to be slightly less annoying, the game will
-// essentially pause itself for specified number of frames
-// if the player is about to lose
-// This "warning" time is quite significant on lower speeds (+ 1 second)
-// but on higher speeds it might be pretty insignificant
-static const uchar WARNING_FRAMES_ALLOWANCE = 1;
+// A victory bursts from at most VICTORY_BURSTS parts, spread evenly
+// along the snake, so that the bursts fill at most half the particle pool
+#define VICTORY_BURST_SIZE 64
+#define VICTORY_BURSTS (PARTICLE_CAPACITY / 2 / VICTORY_BURST_SIZE)
 
 // Internal variables for the game state
 static GameState state;
-static ushort    score;
-static uchar     warningFrames;
-static BOOL      isActive;
+
+// Internal variables for the frame pacing
+// Frames are only drawn when something has changed,
+// or at FPS while the game is being played
+static BOOL      needsRedraw;
+static BOOL      isWindowHidden;
 
 // Internal variables for snake-related functions
+// The simulation runs in the SimThread module, the game only posts
+// commands to it and draws the snapshots it publishes
 static ushort    snakeSpeed;
-static double    snakeTimer;
-static BOOL      hasSnakeEaten;
+static uint      gameId;
+static BOOL      isThreaded = TRUE;
+static int       simTimeout = -1;
+static const Snapshot * pSnapshot;
+
+// Board size, BOARD_WIDTH by BOARD_HEIGHT unless set on the command line
+static ushort    boardWidth = BOARD_WIDTH;
+static ushort    boardHeight = BOARD_HEIGHT;
+
+// Artificial delay after every frame, used to measure tick jitter
+static uint      renderDelay;
+
+// Set when the snake is drawn between ticks, at the display refresh rate
+static BOOL      isInterpolating;
+
+// Internal variables for replay recording
+// Finished games are appended to the file, if one is set
+static FILE *    pReplayFile;
+static ArchiveWriter archiveWriter;
+
+// Set when gameplay events are logged
+static BOOL      isLoggingEvents;
+
+// Set when the game is served to spectators
+static BOOL      isServingSpectators;
+
+// Internal variables for the particle effects
+// eatenScore is the score of the last eat burst. With particleStress
+// set, the pool is topped up to that many particles every frame and
+// the cost of updating and drawing them is printed on exit
+static uint      eatenScore;
+static uint      particleStress;
+static uint      stressFrameCount;
+static Uint64    stressTime;
+static Uint64    stressMaxTime;
+static Uint64    stressStartTime;
+
+// Internal variables for the input latency statistics
+// keyTime is the press time of the key returned by GetInput(), and
+// reportedTime the press time of the last input recorded as presented
+static BOOL      isTrackingLatency;
+static Uint64    keyTime;
+static unsigned long long reportedTime;
+
+// Internal variables for the autoplay, see GameSetAutoplay()
+// The snake is steered once per tick of the snapshots
+static uint      autoplaySeconds;
+static uint      steeredGameId;
+static uint      steeredTick;
 
 // Internal functions
-static SDL_Keycode GetInput(void);
+static SDL_Keycode GetInput(const int timeout);
+static void HandleWindowEvent(const SDL_WindowEvent * pEvent);
+static BOOL IsAnimating(void);
 static void HandleStateMenu(const SDL_Keycode keycode);
 static void HandleStatePlay(const SDL_Keycode keycode);
 static void HandleStateGameOver(const SDL_Keycode keycode);
+static void UpdateSimulation(void);
+static void Autoplay(void);
 static void Reset(void);
 static void DrawScore(void);
 static void DrawGameOver(void);
+static void RecordLatency(void);
+static void UpdateParticles(const float seconds);
 
 // Public functions
 
@@ -46,6 +117,15 @@ static void DrawGameOver(void);
 void GameInitialise(void)
 {
     MenuInitialise(cStateMenu);
+    SimThreadInitialise(boardWidth, boardHeight);
+    if(!ParticlesInitialise())
+    {
+        printf("Cannot allocate the particles\n");
+    }
+    if(!SnakeGridInitialise(boardWidth, boardHeight))
+    {
+        printf("Cannot allocate the snake index\n");
+    }
     state       = cStateMenu;
     snakeSpeed  = MAX_SPEED / 2;
     Reset();
@@ -55,40 +135,136 @@ void GameInitialise(void)
 // Free all resources
 void GameFree(void)
 {
-    BoardFree();
-    SnakeFree();
+    SimThreadFree();
+    if(renderDelay > 0)
+    {
+        uint count = 0;
+        double averageMs = 0.0;
+        double maxMs = 0.0;
+        SimThreadGetTickStats(&count, &averageMs, &maxMs);
+        printf("Tick jitter over %u intervals: average %.3f ms, max %.3f ms\n", count, averageMs, maxMs);
+    }
+    if(particleStress > 0 && stressFrameCount > 0)
+    {
+        const double FREQUENCY = (double)SDL_GetPerformanceFrequency();
+        const double SECONDS = (double)(SDL_GetPerformanceCounter() - stressStartTime) / FREQUENCY;
+        printf("Particle stress: %u particles, %u frames at %.1f FPS, update and draw %.3f ms average, %.3f ms max\n",
+               particleStress, stressFrameCount, stressFrameCount / SECONDS,
+               (double)stressTime * 1000.0 / FREQUENCY / stressFrameCount, (double)stressMaxTime * 1000.0 / FREQUENCY);
+    }
     MenuFree();
+    SnakeCacheFree();
+    SnakeMeshFree();
+    SnakeGridFree();
+    ParticlesFree();
+    if(pReplayFile)
+    {
+        fclose(pReplayFile);
+        pReplayFile = NULL;
+    }
+    if(isLoggingEvents)
+    {
+        EventLogFree();
+        if(EventLogGetDroppedCount() > 0)
+        {
+            printf("Event log dropped %u events\n", EventLogGetDroppedCount());
+        }
+        isLoggingEvents = FALSE;
+    }
+    if(isServingSpectators)
+    {
+        SpectatorFree();
+        isServingSpectators = FALSE;
+    }
+    if(archiveWriter.pFile && !ArchiveWriterClose(&archiveWriter))
+    {
+        printf("Cannot write the replay archive index\n");
+    }
+    if(isTrackingLatency)
+    {
+        printf("Input latency at speed %u, %d Hz, vsync %s, %s frames:\n", snakeSpeed, RendererGetRefreshRate(),
+               RendererIsVsync() ? "on" : "off", isInterpolating ? "refresh rate" : "fixed");
+        LatencyPrint(stdout);
+    }
 }
 
 // Main game loop
 // Process input and handle different game states
 // Exit function when state is 'exit'
+//
+// Menus, pause and game over screens are static, so the loop
+// sleeps until an event arrives and only redraws when something changed.
+// Only the play state draws at a fixed FPS, or at the display refresh
+// rate when the snake is interpolated between ticks
+//
+// The snake is moved by the simulation thread, so slow frames do not
+// delay its ticks. If the thread is disabled, the loop also wakes up
+// for every tick and runs the simulation itself
 void GameRun(void)
 {
+    const int REFRESH_RATE = RendererGetRefreshRate();
+    const double FRAME_TIME = 1000.0 / ((isInterpolating && REFRESH_RATE > 0) ? REFRESH_RATE : FPS);
     double currentTime = SDL_GetTicks();
+    double frameTime = currentTime;
+    const double AUTOPLAY_END = currentTime + (autoplaySeconds * 1000.0);
+    GameState drawnState = cStateExit;
+    needsRedraw = TRUE;
 
+    if(isThreaded && !SimThreadStart(TRUE))
+    {
+        isThreaded = FALSE;
+    }
+    pSnapshot = SimThreadGetSnapshot();
+
+    // A frame counts the allocations since the previous one was drawn
+    ALLOC_SCOPE_BEGIN(cAllocScopeFrame);
     while(state != cStateExit)
     {
-        RendererClear();
+        const GameState OLD_STATE = state;
+
+        // Sleep until the next frame is due, or indefinitely if nothing animates
+        int timeout = isThreaded ? -1 : simTimeout;
+        if(IsAnimating())
+        {
+            const double REMAINING = FRAME_TIME - (SDL_GetTicks() - frameTime);
+            const int FRAME_TIMEOUT = (REMAINING > 0.0) ? (int)REMAINING : 0;
+            timeout = (timeout < 0 || FRAME_TIMEOUT < timeout) ? FRAME_TIMEOUT : timeout;
+        }
+        TRACE_BEGIN(GetInput);
+        const SDL_Keycode KEY_CODE = GetInput(timeout);
+        TRACE_END(GetInput);
+        currentTime = SDL_GetTicks();
 
-        double newTime = SDL_GetTicks();
-        snakeTimer += newTime - currentTime;
-        currentTime = newTime;
+#ifdef TRACE
+        if(KEY_CODE == SDLK_F12)
+        {
+            TraceExport(TRACE_FILE);
+        }
+#endif // TRACE
+
+        // The autoplay stands in for the user until its time is up
+        if(autoplaySeconds > 0)
+        {
+            state = (currentTime < AUTOPLAY_END) ? state : cStateExit;
+            Autoplay();
+        }
 
         // Handle the current state and change state if needed
-        const SDL_Keycode KEY_CODE = GetInput();
         if(state == cStateMenu || state == cStatePause || state == cStateConfig)
         {
             HandleStateMenu(KEY_CODE);
         }
         else if(state == cStatePlay)
         {
+            TRACE_BEGIN(HandleStatePlay);
             HandleStatePlay(KEY_CODE);
+            TRACE_END(HandleStatePlay);
         }
         else if(state == cStateVictory || state == cStateDefeat)
         {
             HandleStateGameOver(KEY_CODE);
         }
+        UpdateSimulation();
 
         // Other states can invoke exit
         if(state == cStateExit)
@@ -96,12 +272,27 @@ void GameRun(void)
             return;
         }
 
+        if(state != OLD_STATE || (IsAnimating() && currentTime - frameTime >= FRAME_TIME))
+        {
+            needsRedraw = TRUE;
+        }
+        if(!needsRedraw || isWindowHidden)
+        {
+            continue;
+        }
+        needsRedraw = FALSE;
+        const double ELAPSED_MS = currentTime - frameTime;
+        const float SECONDS = (ELAPSED_MS < 100.0) ? (float)(ELAPSED_MS / 1000.0) : 0.1f;
+        frameTime = currentTime;
+
         // Render the relevant game elements
+        RendererClear();
         if(state != cStateMenu && state != cStateConfig)
         {
             DrawScore();
-            BoardDraw();
-            SnakeDraw();
+            CameraUpdate(pSnapshot, SECONDS);
+            BoardDraw(pSnapshot);
+            SnakeDraw(pSnapshot);
             if(state == cStatePause)
             {
                 MenuDraw();
@@ -115,26 +306,141 @@ void GameRun(void)
         {
             MenuDraw();
         }
+        UpdateParticles(SECONDS);
+        if(isTrackingLatency)
+        {
+            LatencyDraw();
+        }
 
         RendererDraw();
-        SDL_Delay((1.0 / FPS) * 1000);
+        if(isTrackingLatency && state != cStateMenu && state != cStateConfig)
+        {
+            RecordLatency();
+        }
+
+        // Play frames after the first one should never allocate
+        ALLOC_SCOPE_END(cAllocScopeFrame, state == cStatePlay && drawnState == cStatePlay);
+        ALLOC_SCOPE_BEGIN(cAllocScopeFrame);
+        drawnState = state;
+        if(renderDelay > 0)
+        {
+            SDL_Delay(renderDelay);
+        }
     }
 }
 
+// Play on a board of width by height cells
+// Boards larger than the window are followed by the camera, see camera.h
+// Must be called before GameInitialise()
+void GameSetBoardSize(const ushort width, const ushort height)
+{
+    boardWidth  = width;
+    boardHeight = height;
+}
+
 // Setter for snakeSpeed
 void GameSetSpeed(const uchar speed)
 {
     snakeSpeed = speed;
 }
 
-// Get the first valid keyboard or exit input
+// Append every finished game to the replay file at pPath
+// Paths ending in ".rsa" are written as a replay archive
+// Return FALSE if the file cannot be opened
+BOOL GameRecordReplays(const char * pPath)
+{
+    const size_t LENGTH = strlen(pPath);
+    if(LENGTH > 4 && strcmp(pPath + LENGTH - 4, ".rsa") == 0)
+    {
+        if(SimulationIsWrapping())
+        {
+            printf("Games on a wrapping board are not stored in archives\n");
+        }
+        const BOOL IS_OPEN = ArchiveWriterOpen(&archiveWriter, pPath);
+        SimThreadRecordArchive(IS_OPEN ? &archiveWriter : NULL);
+        return IS_OPEN;
+    }
+    pReplayFile = fopen(pPath, "a");
+    SimThreadRecordReplays(pReplayFile);
+    return pReplayFile != NULL;
+}
+
+// Log gameplay events to the binary log file at pPath
+// Must be called before GameRun()
+// Return FALSE if the log cannot be started
+BOOL GameLogEvents(const char * pPath)
+{
+    isLoggingEvents = EventLogInitialise(pPath);
+    return isLoggingEvents;
+}
+
+// Serve the game to spectators on the Unix domain socket at pPath
+// Must be called before GameRun()
+// Return FALSE if the socket cannot be opened
+BOOL GameServeSpectators(const char * pPath)
+{
+    isServingSpectators = SpectatorInitialise(pPath, boardWidth, boardHeight);
+    return isServingSpectators;
+}
+
+// Run the simulation in the game loop instead of on its own thread
+// Must be called before GameRun()
+void GameSetThreaded(const BOOL threaded)
+{
+    isThreaded = threaded;
+}
+
+// Wait 'delay' milliseconds after every frame
+// Simulates a slow renderer; tick jitter is printed on exit
+void GameSetRenderDelay(const uint delay)
+{
+    renderDelay = delay;
+}
+
+// Draw the snake between ticks, see SnakeSetInterpolation()
+// Frames are then drawn at the display refresh rate
+void GameSetInterpolation(const BOOL isEnabled)
+{
+    isInterpolating = isEnabled;
+    SnakeSetInterpolation(isEnabled);
+}
+
+// Measure the time from arrow key presses to the frames that show them,
+// see latency.h. The statistics are drawn over the game and printed on exit
+void GameTrackLatency(const BOOL isEnabled)
+{
+    isTrackingLatency = isEnabled;
+    LatencyInitialise();
+}
+
+// Keep 'count' particles alive in every state, and print
+// the time taken to update and draw them on exit
+// Used to check that the particle pool holds the frame rate
+void GameSetParticleStress(const uint count)
+{
+    particleStress = count;
+}
+
+// Play by itself for 'seconds' and exit, without any input
+// The snake is steered towards the food and a new game starts
+// as soon as one ends, so nearly every frame is a play frame.
+// Used to check that the game loop does not allocate, see alloctrack.h
+void GameSetAutoplay(const uint seconds)
+{
+    autoplaySeconds = seconds;
+}
+
+// Wait up to 'timeout' milliseconds (-1 for no limit) for events
+// and return the first valid keyboard or exit input
 // If exit event, set the internal state to 'exit'
-// If a valid keyboard input (keydown), set
-//   the pKeyCode and return
-static SDL_Keycode GetInput(void)
+// If a valid keyboard input (keydown), keep
+//   its press time and return the key code
+// Window events are handled as they are found
+static SDL_Keycode GetInput(const int timeout)
 {
     SDL_Event e;
-    while(SDL_PollEvent(&e))
+    BOOL hasEvent = SDL_WaitEventTimeout(&e, timeout);
+    while(hasEvent)
     {
         if(e.type == SDL_QUIT)
         {
@@ -143,12 +449,68 @@ static SDL_Keycode GetInput(void)
         }
         else if(e.type == SDL_KEYDOWN)
         {
+            needsRedraw = TRUE;
+            keyTime = isTrackingLatency ? LatencyGetPressTime(e.key.timestamp) : 0;
             return e.key.keysym.sym;
         }
+        else if(e.type == SDL_WINDOWEVENT)
+        {
+            HandleWindowEvent(&e.window);
+        }
+        hasEvent = SDL_PollEvent(&e);
     }
     return SDLK_UNKNOWN;
 }
 
+// Track window visibility and focus
+// Rendering is suspended while the window is hidden
+// and the game is paused when the window loses focus
+static void HandleWindowEvent(const SDL_WindowEvent * pEvent)
+{
+    switch(pEvent->event)
+    {
+        case SDL_WINDOWEVENT_HIDDEN:
+        case SDL_WINDOWEVENT_MINIMIZED:
+            isWindowHidden = TRUE;
+            break;
+
+        case SDL_WINDOWEVENT_SHOWN:
+        case SDL_WINDOWEVENT_RESTORED:
+        case SDL_WINDOWEVENT_MAXIMIZED:
+            isWindowHidden = FALSE;
+            needsRedraw = TRUE;
+            break;
+
+        // The software framebuffer takes the new size when
+        // the frame is cleared, see RendererClear()
+        case SDL_WINDOWEVENT_EXPOSED:
+        case SDL_WINDOWEVENT_SIZE_CHANGED:
+            needsRedraw = TRUE;
+            break;
+
+        case SDL_WINDOWEVENT_FOCUS_LOST:
+            if(state == cStatePlay && autoplaySeconds == 0)
+            {
+                state = cStatePause;
+                MenuSetType(cStatePause);
+                SimThreadPost(cCommandPause, 0);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+// Return TRUE if the current state needs to be drawn every frame
+// The food colour cycles and the snake moves, so play animates,
+// and so does any state while particles are alive or autoplaying
+static BOOL IsAnimating(void)
+{
+    return (state == cStatePlay || ParticlesGetCount() > 0 || particleStress > 0 || autoplaySeconds > 0)
+           && !isWindowHidden;
+}
+
 // Update the menu object
 // If the menu type does not match the game state
 // Change the menu type before updating
@@ -165,146 +527,171 @@ static void HandleStateMenu(const SDL_Keycode keycode)
         Reset();
         //GameSetSpeed(6);
     }
+    else if(OLD_STATE == cStatePause && state == cStatePlay)
+    {
+        SimThreadPost(cCommandResume, 0);
+    }
 }
 
 // Update the game's logic
-// Process the input and change snake's position and
-// movement (if needed)
-// Snake's logic is only updated according to the speed value
+// Process the input and forward it to the simulation
+// The snake itself is moved by the simulation according to the speed value
 // eg. speed 1 = 1 fps, speed 10 = 10 fps
 static void HandleStatePlay(const SDL_Keycode keycode)
 {
-#define ACTIVATE do { if(!isActive) { isActive = TRUE; } } while(FALSE)
     switch(keycode)
     {
         case SDLK_UP:
-            SnakeSetDirection(cDirectionUp);
-            ACTIVATE;
+            SimThreadPostInput(cDirectionUp, keyTime);
             break;
 
         case SDLK_DOWN:
-            SnakeSetDirection(cDirectionDown);
-            ACTIVATE;
+            SimThreadPostInput(cDirectionDown, keyTime);
             break;
 
         case SDLK_LEFT:
-            SnakeSetDirection(cDirectionLeft);
-            ACTIVATE;
+            SimThreadPostInput(cDirectionLeft, keyTime);
             break;
 
         case SDLK_RIGHT:
-            SnakeSetDirection(cDirectionRight);
-            ACTIVATE;
+            SimThreadPostInput(cDirectionRight, keyTime);
             break;
 
         case SDLK_ESCAPE:
             state = cStatePause;
             MenuSetType(cStatePause);
+            SimThreadPost(cCommandPause, 0);
             return;
 
 #ifdef DEBUG
         case SDLK_KP_PLUS:
-            SnakeAddBodyPart();
+            SimThreadPost(cCommandGrow, 0);
             break;
 #endif // DEBUG
 
         default:
             break;
     }
-#undef ACTIVATE
+}
 
-    // Snake has its own framerate
-    if(!isActive || snakeTimer < (1.0 / snakeSpeed) * 1000)
+// Handle game over state (either victory or loss)
+static void HandleStateGameOver(const SDL_Keycode keycode)
+{
+    if(keycode == SDLK_RETURN || keycode == SDLK_ESCAPE)
     {
-        return;
+        state = cStateMenu;
+        MenuSetType(cStateMenu);
     }
-    snakeTimer = 0.0;
-
-    const BOOL  HAS_DIRECTION_CHANGED = SnakeUpdateDirection();
-    const Point NEXT_HEAD_POINT = SnakeGetNextHeadPoint();
+}
 
-    // Check if snake is about to lose, but ignore if next head position is
-    // tail, as the tail will move out of the way
-    if(!BoardIsCellValid(NEXT_HEAD_POINT) && !PointsAreEqual(NEXT_HEAD_POINT, SnakeGetTail()->point))
+// Run the simulation if it has no thread of its own
+// and pick up the latest snapshot
+// Switch to game over when the current game has finished
+// Food eaten since the last snapshot bursts from the head,
+// and a victory bursts along the whole snake
+static void UpdateSimulation(void)
+{
+    if(!isThreaded)
     {
-        // If we haven't changed the snake's direction and still have
-        // warning frame allowance, use that and return
-        if(!HAS_DIRECTION_CHANGED && warningFrames++ < WARNING_FRAMES_ALLOWANCE)
-        {
-            return;
-        }
+        simTimeout = SimThreadUpdate();
+    }
+    pSnapshot = SimThreadGetSnapshot();
 
-        // Snake lost. Change state and return
-        // We're not updating the position to make it look better
-        state = cStateDefeat;
+    // Snapshots of the previous game may still arrive after a reset
+    if(state != cStatePlay || pSnapshot->gameId != gameId)
+    {
         return;
     }
-    warningFrames = 0; // Reset warning frames
-
-    // If snake has just eaten, the board state and snake might be out of sync
-    // causing the food to spawn on the snake's tail
-    // Only update the tail if snake has NOT eaten
-    if(!hasSnakeEaten)
+    if(pSnapshot->score > eatenScore)
+    {
+        ParticlesEmitCell(pSnapshot->pBodyArr[0], 48, 240.0f);
+        eatenScore = pSnapshot->score;
+    }
+    if(pSnapshot->result == cTickVictory)
     {
-        BoardSetCell(SnakeGetTail()->point, cTypeFree);
+        state = cStateVictory;
+        const uint BURSTS = (pSnapshot->length < VICTORY_BURSTS) ? pSnapshot->length : VICTORY_BURSTS;
+        for(uint burst = 0; burst < BURSTS && ParticlesGetCount() < PARTICLE_CAPACITY; burst++)
+        {
+            const uint PART = (uint)(((unsigned long long)burst * pSnapshot->length) / BURSTS);
+            ParticlesEmitCell(pSnapshot->pBodyArr[PART], VICTORY_BURST_SIZE, 480.0f);
+        }
     }
-    else
+    else if(pSnapshot->result == cTickDefeat)
     {
-        hasSnakeEaten = FALSE;
+        state = cStateDefeat;
     }
+}
 
-    // Update the snake's position and maybe handle food
-    SnakeMove();
-    const Point HEAD_POINT = SnakeGetHead()->point;
+// Play in place of the user, see GameSetAutoplay()
+// A finished game is restarted once its game over screen has been drawn.
+// On every new tick, the snake turns to the free neighbouring cell
+// closest to the food, or keeps going if there is none
+static void Autoplay(void)
+{
+    static const Direction DIRECTION_ARR[4] = { cDirectionUp, cDirectionDown, cDirectionLeft, cDirectionRight };
 
-    if(BoardGetCell(HEAD_POINT) == cTypeFood)
+    if(state == cStateMenu || state == cStateVictory || state == cStateDefeat)
     {
-        SnakeAddBodyPart();
-        score += 5;
-        hasSnakeEaten = TRUE;
+        state = cStatePlay;
+        Reset();
+        return;
     }
-    BoardSetCell(HEAD_POINT, cTypeSnake);
-    if(hasSnakeEaten && !BoardGenerateFood())
+    if(state != cStatePlay || pSnapshot->gameId != gameId || pSnapshot->length == 0
+    || (pSnapshot->gameId == steeredGameId && pSnapshot->tickCount == steeredTick))
     {
-        state = cStateVictory;
+        return;
     }
-}
+    steeredGameId = pSnapshot->gameId;
+    steeredTick   = pSnapshot->tickCount;
+
+    const int WIDTH  = pSnapshot->width;
+    const int HEIGHT = pSnapshot->height;
+    const BOOL IS_WRAPPING = SimulationIsWrapping();
+    const Point HEAD = pSnapshot->pBodyArr[0];
+    Direction best = cDirectionUp;
+    int bestDistance = -1;
+    for(uint i = 0; i < 4; i++)
+    {
+        const Direction DIRECTION = DIRECTION_ARR[i];
+        int x = HEAD.x + ((DIRECTION == cDirectionRight) - (DIRECTION == cDirectionLeft));
+        int y = HEAD.y + ((DIRECTION == cDirectionDown) - (DIRECTION == cDirectionUp));
+        if(IS_WRAPPING)
+        {
+            x = (x + WIDTH) % WIDTH;
+            y = (y + HEIGHT) % HEIGHT;
+        }
 
-// Handle game over state (either victory or loss)
-static void HandleStateGameOver(const SDL_Keycode keycode)
-{
-    if(keycode == SDLK_RETURN || keycode == SDLK_ESCAPE)
+        // Turning back always runs into the body, so it is never picked
+        const uchar CELL = pSnapshot->pCellArr[((y + 1) * (WIDTH + 2)) + x + 1];
+        if(CELL != cTypeFree && CELL != cTypeFood)
+        {
+            continue;
+        }
+        const int DISTANCE = abs(pSnapshot->food.x - x) + abs(pSnapshot->food.y - y);
+        if(bestDistance < 0 || DISTANCE < bestDistance)
+        {
+            best = DIRECTION;
+            bestDistance = DISTANCE;
+        }
+    }
+    if(bestDistance >= 0)
     {
-        state = cStateMenu;
-        MenuSetType(cStateMenu);
+        SimThreadPostInput(best, 0);
     }
 }
 
 // Reset board and game data
+// Every game gets its own seed so that it can be recorded
 static void Reset(void)
 {
-    BoardFree();
-    SnakeFree();
-
-    BoardInitialise();
-
-    const Point INITIAL_POINT = { BOARD_WIDTH / 2, BOARD_HEIGHT / 2 };
-    SnakeInitialise(INITIAL_POINT, SNAKE_INIT_LENGTH);
-
-    SnakePart * pCurrent = NULL;
-    for(pCurrent = SnakeGetHead(); pCurrent; pCurrent = pCurrent->pNext)
-    {
-        BoardSetCell(pCurrent->point, cTypeSnake);
-    }
-    BoardGenerateFood();
-
-    score       = 0;
-    warningFrames = 0;
-    isActive    = FALSE;
+    const uint SEED = ((uint)rand() << 16) ^ (uint)rand();
 
     // snakeSpeed = 1; // Use GameSetSpeed() function
-    snakeTimer = 0.0;
-    hasSnakeEaten = FALSE;
+    SimThreadPost(cCommandSpeed, snakeSpeed);
+    SimThreadPost(cCommandReset, SEED);
+    gameId++;
+    eatenScore = 0;
 }
 
 // Draw the score component
@@ -313,11 +700,11 @@ static void DrawScore(void)
     // We want to pad the score to look like this (0005)
     // Determine maximum possible score
     char pad[10];
-    sprintf(pad, "%d", BOARD_WIDTH * BOARD_HEIGHT * 5);
+    sprintf(pad, "%u", (uint)pSnapshot->width * pSnapshot->height * 5);
 
     // Construct the score string
     char text[25];
-    snprintf(text, 25, "SCORE: %0*d", (int)strlen(pad), score);
+    snprintf(text, 25, "SCORE: %0*u", (int)strlen(pad), pSnapshot->score);
 
     int windowWidth = 0;
     int windowHeight = 0;
@@ -350,3 +737,45 @@ static void DrawGameOver(void)
     char * pPromptText = "Press <Enter> or <Escape> to continue";
     RendererDrawText(pPromptText, colour, windowWidth / 2, windowHeight, FALSE);
 }
+
+// Record the latency of the last applied input
+// once the first frame showing its tick has been presented
+static void RecordLatency(void)
+{
+    if(pSnapshot->inputTime == 0 || pSnapshot->inputTime == reportedTime)
+    {
+        return;
+    }
+    reportedTime = pSnapshot->inputTime;
+    LatencyRecordPresent(pSnapshot->inputTime, pSnapshot->inputTickTime, SDL_GetPerformanceCounter());
+}
+
+// Move the particles and draw them over the frame
+// The stress scene refills the pool from random points of the window
+static void UpdateParticles(const float seconds)
+{
+    const Uint64 START = SDL_GetPerformanceCounter();
+    ParticlesUpdate(seconds);
+    if(particleStress > 0)
+    {
+        int windowWidth = 0;
+        int windowHeight = 0;
+        RendererGetWindowSize(&windowWidth, &windowHeight);
+        uint missing = (particleStress > ParticlesGetCount()) ? particleStress - ParticlesGetCount() : 0;
+        while(missing > 0)
+        {
+            const uint BURST = (missing < 256) ? missing : 256;
+            ParticlesEmit((float)(rand() % (windowWidth + 1)), (float)(rand() % (windowHeight + 1)), BURST, 360.0f);
+            missing -= BURST;
+        }
+    }
+    ParticlesDraw();
+    if(particleStress > 0)
+    {
+        const Uint64 TIME = SDL_GetPerformanceCounter() - START;
+        stressStartTime = (stressFrameCount == 0) ? START : stressStartTime;
+        stressTime     += TIME;
+        stressMaxTime   = (TIME > stressMaxTime) ? TIME : stressMaxTime;
+        stressFrameCount++;
+    }
+}
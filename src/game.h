@@ -6,6 +6,16 @@
 void GameInitialise(void);
 void GameFree(void);
 void GameRun(void);
+void GameSetBoardSize(const ushort width, const ushort height);
 void GameSetSpeed(const uchar speed);
+BOOL GameRecordReplays(const char * pPath);
+BOOL GameLogEvents(const char * pPath);
+BOOL GameServeSpectators(const char * pPath);
+void GameSetThreaded(const BOOL threaded);
+void GameSetRenderDelay(const uint delay);
+void GameSetInterpolation(const BOOL isEnabled);
+void GameTrackLatency(const BOOL isEnabled);
+void GameSetParticleStress(const uint count);
+void GameSetAutoplay(const uint seconds);
 
 #endif // !GAME_H
@@ -6,6 +6,10 @@
 // Game area dimensions
 #define BOARD_WIDTH 15
 #define BOARD_HEIGHT 10
+
+// Range of board sizes accepted on the command line
+#define MIN_BOARD_SIZE 5
+#define MAX_BOARD_SIZE 1024
 extern const ushort CELL_SIZE;
 
 // Game definitions
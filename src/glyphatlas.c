@@ -0,0 +1,223 @@
+#include "glyphatlas.h"
+
+#include <stdlib.h>
+
+#include "renderer.h"
+#include "framebuffer.h"
+#include "fontdata.h"
+
+// Glyphs drawn per SDL_RenderGeometry() call
+#define BATCH_GLYPHS 64
+
+// Internal variables
+static SDL_Texture * pTexture = NULL;  // Accelerated backend
+static SDL_Surface * pSurface = NULL;  // Software backend
+static SDL_Vertex    vertexArr[BATCH_GLYPHS * 4];
+static int           indexArr[BATCH_GLYPHS * 6];
+
+// Internal functions
+
+// Return the glyph of a printable character
+static inline const FontGlyph * GlyphOf(const char c)
+{
+    return &FONT_GLYPH_ARR[(uchar)c - FONT_FIRST_CHAR];
+}
+
+// Expand the one bit atlas into white ARGB8888 pixels,
+// transparent where the bit is clear
+static void ExpandAtlas(Uint32 * pPixels, const int pitch)
+{
+    for(int y = 0; y < FONT_ATLAS_HEIGHT; y++)
+    {
+        Uint32 * pRow = (Uint32 *)((uchar *)pPixels + ((size_t)y * pitch));
+        const uchar * pBits = &FONT_ATLAS_BITS[y * (FONT_ATLAS_WIDTH / 8)];
+        for(int x = 0; x < FONT_ATLAS_WIDTH; x++)
+        {
+            const BOOL IS_SET = (pBits[x / 8] >> (7 - (x % 8))) & 1;
+            pRow[x] = IS_SET ? FramebufferMakeColour(255, 255, 255, SDL_ALPHA_OPAQUE) : 0;
+        }
+    }
+}
+
+// Write the quad of one glyph into the batch
+static void WriteGlyphQuad(SDL_Vertex * pVertex, const FontGlyph * pGlyph, const float x, const float y,
+                           const float scaleX, const float scaleY, const SDL_Color colour)
+{
+    for(int corner = 0; corner < 4; corner++)
+    {
+        const int U = pGlyph->x + ((corner & 1) ? pGlyph->w : 0);
+        const int V = pGlyph->y + ((corner & 2) ? pGlyph->h : 0);
+        pVertex[corner].position.x  = x + ((corner & 1) ? pGlyph->w * scaleX : 0.0f);
+        pVertex[corner].position.y  = y + ((corner & 2) ? pGlyph->h * scaleY : 0.0f);
+        pVertex[corner].color       = colour;
+        pVertex[corner].tex_coord.x = (float)U / FONT_ATLAS_WIDTH;
+        pVertex[corner].tex_coord.y = (float)V / FONT_ATLAS_HEIGHT;
+    }
+}
+
+// Public functions
+
+// "Constructor"
+// Upload the atlas for the active rendering backend
+// Return false if the texture or surface cannot be created
+BOOL GlyphAtlasInitialise(void)
+{
+    GlyphAtlasFree();
+
+    if(RendererGetBackend() == cBackendSoftware)
+    {
+        pSurface = SDL_CreateRGBSurfaceWithFormat(0, FONT_ATLAS_WIDTH, FONT_ATLAS_HEIGHT, 32, SDL_PIXELFORMAT_ARGB8888);
+        if(!pSurface)
+        {
+            return FALSE;
+        }
+        ExpandAtlas((Uint32 *)pSurface->pixels, pSurface->pitch);
+        SDL_SetSurfaceBlendMode(pSurface, SDL_BLENDMODE_BLEND);
+        return TRUE;
+    }
+
+    Uint32 * pPixels = (Uint32 *)malloc((size_t)FONT_ATLAS_WIDTH * FONT_ATLAS_HEIGHT * sizeof(Uint32));
+    pTexture = SDL_CreateTexture(GetRenderer(), SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, FONT_ATLAS_WIDTH, FONT_ATLAS_HEIGHT);
+    if(!pPixels || !pTexture)
+    {
+        free(pPixels);
+        GlyphAtlasFree();
+        return FALSE;
+    }
+    ExpandAtlas(pPixels, FONT_ATLAS_WIDTH * sizeof(Uint32));
+    SDL_UpdateTexture(pTexture, NULL, pPixels, FONT_ATLAS_WIDTH * sizeof(Uint32));
+    SDL_SetTextureBlendMode(pTexture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(pTexture, SDL_ScaleModeNearest);
+    free(pPixels);
+
+    // Every glyph is two triangles, (0,1,2) and (2,1,3)
+    for(int i = 0; i < BATCH_GLYPHS; i++)
+    {
+        indexArr[(i * 6) + 0] = (i * 4) + 0;
+        indexArr[(i * 6) + 1] = (i * 4) + 1;
+        indexArr[(i * 6) + 2] = (i * 4) + 2;
+        indexArr[(i * 6) + 3] = (i * 4) + 2;
+        indexArr[(i * 6) + 4] = (i * 4) + 1;
+        indexArr[(i * 6) + 5] = (i * 4) + 3;
+    }
+    return TRUE;
+}
+
+// "Destructor"
+void GlyphAtlasFree(void)
+{
+    if(pTexture)
+    {
+        SDL_DestroyTexture(pTexture);
+        pTexture = NULL;
+    }
+    if(pSurface)
+    {
+        SDL_FreeSurface(pSurface);
+        pSurface = NULL;
+    }
+}
+
+// Draw the text stretched over the rectangle
+// The rectangle is usually GlyphAtlasSizeText(), or a multiple of it
+void GlyphAtlasDraw(const char * pText, const SDL_Color colour, const SDL_Rect * pRect)
+{
+    int textWidth = 0;
+    int textHeight = 0;
+    GlyphAtlasSizeText(pText, &textWidth, &textHeight);
+    if(textWidth == 0)
+    {
+        return;
+    }
+    const float SCALE_X = (float)pRect->w / textWidth;
+    const float SCALE_Y = (float)pRect->h / textHeight;
+
+    if(pSurface)
+    {
+        SDL_SetSurfaceColorMod(pSurface, colour.r, colour.g, colour.b);
+        int penX = 0;
+        for(const char * pChar = pText; *pChar; pChar++)
+        {
+            const FontGlyph * pGlyph = GlyphOf(*pChar);
+            SDL_Rect source;
+            source.x = pGlyph->x;
+            source.y = pGlyph->y;
+            source.w = pGlyph->w;
+            source.h = pGlyph->h;
+            SDL_Rect r;
+            r.x = pRect->x + (int)((penX + pGlyph->left) * SCALE_X);
+            r.y = pRect->y + (int)((FONT_ASCENT - pGlyph->top) * SCALE_Y);
+            r.w = (int)(pGlyph->w * SCALE_X);
+            r.h = (int)(pGlyph->h * SCALE_Y);
+            FramebufferBlitSurfaceRect(pSurface, &source, &r);
+            penX += pGlyph->advance;
+        }
+        return;
+    }
+
+    if(!pTexture)
+    {
+        return;
+    }
+    int penX = 0;
+    int count = 0;
+    for(const char * pChar = pText; *pChar; pChar++)
+    {
+        const FontGlyph * pGlyph = GlyphOf(*pChar);
+        WriteGlyphQuad(&vertexArr[count * 4], pGlyph,
+                       pRect->x + ((penX + pGlyph->left) * SCALE_X),
+                       pRect->y + ((FONT_ASCENT - pGlyph->top) * SCALE_Y),
+                       SCALE_X, SCALE_Y, colour);
+        penX += pGlyph->advance;
+        if(++count == BATCH_GLYPHS || !pChar[1])
+        {
+            SDL_RenderGeometry(GetRenderer(), pTexture, vertexArr, count * 4, indexArr, count * 6);
+            count = 0;
+        }
+    }
+}
+
+// Return TRUE if every character of the text is in the atlas
+BOOL GlyphAtlasCanDraw(const char * pText)
+{
+    for(const char * pChar = pText; *pChar; pChar++)
+    {
+        if((uchar)*pChar < FONT_FIRST_CHAR || (uchar)*pChar > FONT_LAST_CHAR)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+// Measure the text like TTF_SizeText()
+// Every character must be in the atlas
+void GlyphAtlasSizeText(const char * pText, int * pW, int * pH)
+{
+    int penX = 0;
+    int right = 0;
+    for(const char * pChar = pText; *pChar; pChar++)
+    {
+        const FontGlyph * pGlyph = GlyphOf(*pChar);
+        if(penX + pGlyph->left + pGlyph->w > right)
+        {
+            right = penX + pGlyph->left + pGlyph->w;
+        }
+        penX += pGlyph->advance;
+    }
+    *pW = (penX > right) ? penX : right;
+    *pH = FONT_HEIGHT;
+}
+
+// Return the embedded font file
+const uchar * GlyphAtlasGetFontData(uint * pSize)
+{
+    *pSize = sizeof(FONT_TTF_DATA);
+    return FONT_TTF_DATA;
+}
+
+// Return the point size the atlas was rasterised at
+int GlyphAtlasGetPointSize(void)
+{
+    return FONT_POINT_SIZE;
+}
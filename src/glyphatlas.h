@@ -0,0 +1,28 @@
+#ifndef GLYPHATLAS_H
+#define GLYPHATLAS_H
+
+#include <SDL2/SDL.h>
+
+#include "types.h"
+
+// Text drawn from a pre-rasterised glyph atlas
+//
+// The printable ASCII characters of font.ttf are rasterised at build time
+// into src/fontdata.h (see tools/fontatlas.c), together with the font file
+// itself. The atlas is expanded into one texture (or surface, for the
+// software backend) at startup, and a string is drawn as one batch of
+// textured quads, tinted by the text colour. Text with other characters
+// has to go through SDL_ttf instead
+
+// Main functions
+BOOL GlyphAtlasInitialise(void);
+void GlyphAtlasFree(void);
+void GlyphAtlasDraw(const char * pText, const SDL_Color colour, const SDL_Rect * pRect);
+
+// Helper functions
+BOOL GlyphAtlasCanDraw(const char * pText);
+void GlyphAtlasSizeText(const char * pText, int * pW, int * pH);
+const uchar * GlyphAtlasGetFontData(uint * pSize);
+int GlyphAtlasGetPointSize(void);
+
+#endif // !GLYPHATLAS_H
@@ -0,0 +1,159 @@
+#include "latency.h"
+
+#include <string.h>
+
+#include "renderer.h"
+
+// Histogram size, the last bucket holds everything from LATENCY_BUCKETS - 1 ms
+#define LATENCY_BUCKETS 250
+
+// Width of the longest bar in the printed histograms
+#define BAR_WIDTH 40
+
+typedef struct
+{
+    uint   bucketArr[LATENCY_BUCKETS];
+    uint   count;
+    double sumMs;
+    double maxMs;
+} Histogram;
+
+// Internal variables
+static Histogram histogramArr[cLatencyStageCount];
+static const char * const STAGE_NAMES[cLatencyStageCount] = { "input to tick", "tick to present", "input to present" };
+
+// Internal functions
+
+// Add one measurement between two performance counter values
+static void Record(const LatencyStage stage, const Uint64 start, const Uint64 end)
+{
+    Histogram * pHistogram = &histogramArr[stage];
+    const double MS = (end > start) ? (double)(end - start) * 1000.0 / (double)SDL_GetPerformanceFrequency() : 0.0;
+    const uint BUCKET = (MS < LATENCY_BUCKETS - 1) ? (uint)MS : LATENCY_BUCKETS - 1;
+    pHistogram->bucketArr[BUCKET]++;
+    pHistogram->count++;
+    pHistogram->sumMs += MS;
+    pHistogram->maxMs = (MS > pHistogram->maxMs) ? MS : pHistogram->maxMs;
+}
+
+// Return the upper bound in milliseconds of the bucket holding the
+// given fraction of the measurements
+static uint Percentile(const Histogram * pHistogram, const double fraction)
+{
+    const uint RANK = (uint)(fraction * pHistogram->count);
+    uint seen = 0;
+    for(uint bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+    {
+        seen += pHistogram->bucketArr[bucket];
+        if(seen > RANK)
+        {
+            return bucket + 1;
+        }
+    }
+    return LATENCY_BUCKETS;
+}
+
+// Public functions
+
+// "Constructor"
+// Clear the histograms
+void LatencyInitialise(void)
+{
+    memset(histogramArr, 0, sizeof(histogramArr));
+}
+
+// Draw the percentiles of every stage in the top-left corner
+void LatencyDraw(void)
+{
+    SDL_Color colour;
+    colour.r = 255;
+    colour.g = 255;
+    colour.b = 255;
+    colour.a = SDL_ALPHA_OPAQUE;
+
+    int lineHeight = 0;
+    for(uint stage = 0; stage < cLatencyStageCount; stage++)
+    {
+        const Histogram * pHistogram = &histogramArr[stage];
+        char text[80];
+        if(pHistogram->count == 0)
+        {
+            snprintf(text, sizeof(text), "%s: -", STAGE_NAMES[stage]);
+        }
+        else
+        {
+            snprintf(text, sizeof(text), "%s: p50 %u p99 %u max %.0f ms (%u)", STAGE_NAMES[stage],
+                     Percentile(pHistogram, 0.5), Percentile(pHistogram, 0.99), pHistogram->maxMs, pHistogram->count);
+        }
+
+        // RendererDrawText() centres the text above the point
+        int w = 0;
+        int h = 0;
+        RendererSizeText(text, &w, &h);
+        lineHeight = (h > lineHeight) ? h : lineHeight;
+        RendererDrawText(text, colour, (ushort)(8 + (w / 2)), (ushort)((h * 3 / 2) + 8 + (stage * lineHeight)), FALSE);
+    }
+}
+
+// Print the statistics and the non-empty buckets of every stage
+void LatencyPrint(FILE * pFile)
+{
+    for(uint stage = 0; stage < cLatencyStageCount; stage++)
+    {
+        const Histogram * pHistogram = &histogramArr[stage];
+        fprintf(pFile, "%s: %u presses", STAGE_NAMES[stage], pHistogram->count);
+        if(pHistogram->count == 0)
+        {
+            fprintf(pFile, "\n");
+            continue;
+        }
+        fprintf(pFile, ", mean %.2f ms, p50 %u ms, p90 %u ms, p99 %u ms, max %.2f ms\n",
+                pHistogram->sumMs / pHistogram->count, Percentile(pHistogram, 0.5),
+                Percentile(pHistogram, 0.9), Percentile(pHistogram, 0.99), pHistogram->maxMs);
+
+        uint largest = 0;
+        for(uint bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+        {
+            largest = (pHistogram->bucketArr[bucket] > largest) ? pHistogram->bucketArr[bucket] : largest;
+        }
+        for(uint bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+        {
+            const uint COUNT = pHistogram->bucketArr[bucket];
+            if(COUNT == 0)
+            {
+                continue;
+            }
+            char bar[BAR_WIDTH + 1];
+            const uint LENGTH = (COUNT * BAR_WIDTH + largest - 1) / largest;
+            memset(bar, '#', LENGTH);
+            bar[LENGTH] = '\0';
+            if(bucket == LATENCY_BUCKETS - 1)
+            {
+                fprintf(pFile, "  %3u+   ms %6u %s\n", bucket, COUNT, bar);
+            }
+            else
+            {
+                fprintf(pFile, "  %3u-%-3u ms %6u %s\n", bucket, bucket + 1, COUNT, bar);
+            }
+        }
+    }
+}
+
+// Convert the timestamp of a key event (SDL_GetTicks() milliseconds)
+// to a performance counter value
+Uint64 LatencyGetPressTime(const Uint32 timestamp)
+{
+    const Uint64 NOW = SDL_GetPerformanceCounter();
+    const Uint32 AGE_MS = SDL_GetTicks() - timestamp;
+    const Uint64 AGE = (Uint64)AGE_MS * SDL_GetPerformanceFrequency() / 1000;
+    return (AGE < NOW) ? NOW - AGE : NOW;
+}
+
+// Record a key press that was applied at tickTime and
+// first shown by the present that finished at presentTime
+void LatencyRecordPresent(const Uint64 pressTime, const Uint64 tickTime, const Uint64 presentTime)
+{
+    Record(cLatencyInputToTick, pressTime, tickTime);
+    Record(cLatencyTickToPresent, tickTime, presentTime);
+    Record(cLatencyInputToPresent, pressTime, presentTime);
+}
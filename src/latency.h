@@ -0,0 +1,38 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdio.h>
+#include <SDL2/SDL.h>
+
+#include "types.h"
+
+// Input latency statistics
+//
+// A key press is followed from its SDL_KEYDOWN timestamp to the tick that
+// applies it (see SimThreadPostInput()), and from that tick to the first
+// present that shows the result. Each stage has a histogram in 1 ms buckets:
+//   input to tick:    waiting for the next tick, set by the snake speed
+//   tick to present:  waiting for the next frame and its present,
+//                     set by the frame pacing and vsync
+//   input to present: the whole delay the player sees
+// Times are performance counter values. SDL timestamps key presses in
+// whole milliseconds, so the stages starting at the input are only
+// accurate to about 1 ms. Only used by the main thread
+typedef enum
+{
+    cLatencyInputToTick    = 0,
+    cLatencyTickToPresent  = 1,
+    cLatencyInputToPresent = 2,
+    cLatencyStageCount     = 3,
+} LatencyStage;
+
+// Main functions
+void LatencyInitialise(void);
+void LatencyDraw(void);
+void LatencyPrint(FILE * pFile);
+
+// Helper functions
+Uint64 LatencyGetPressTime(const Uint32 timestamp);
+void LatencyRecordPresent(const Uint64 pressTime, const Uint64 tickTime, const Uint64 presentTime);
+
+#endif // !LATENCY_H
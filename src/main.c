@@ -1,29 +1,397 @@
 #include <time.h>
+#include <string.h>
+#include <stdio.h>
 
 #include "renderer.h"
+#include "globals.h"
 #include "game.h"
+#include "snake.h"
+#include "camera.h"
+#include "replay.h"
+#include "archive.h"
+#include "eventlog.h"
+#include "trace.h"
+#include "alloctrack.h"
+
+// Play every game in the archive 'repeat' times without a window
+// Games are decoded from the mapping one at a time, so archives of
+// any size are streamed through a single Replay
+// Return the process exit code
+static int RunArchive(const Archive * pArchive, const uint repeat)
+{
+    Replay replay;
+    memset(&replay, 0, sizeof(Replay));
+
+    uint mismatchCount = 0;
+    unsigned long long tickCount = 0;
+    const clock_t START = clock();
+    for(uint r = 0; r < repeat; r++)
+    {
+        for(uint i = 0; i < pArchive->entryCount; i++)
+        {
+            if(!ArchiveReadReplay(pArchive, &pArchive->pEntryArr[i], &replay) || !ReplayPlay(&replay))
+            {
+                mismatchCount++;
+            }
+            tickCount += SimulationGetTickCount();
+        }
+    }
+    const double SECONDS = (double)(clock() - START) / CLOCKS_PER_SEC;
+    const unsigned long long GAME_COUNT = (unsigned long long)pArchive->entryCount * repeat;
+    SimulationFree();
+    ReplayFree(&replay);
+
+    printf("archive: games=%u repeat=%u ticks=%llu mismatches=%u time=%.3fs ticks/sec=%.0f games/sec=%.0f\n",
+           pArchive->entryCount, repeat, tickCount, mismatchCount, SECONDS,
+           (SECONDS > 0.0) ? tickCount / SECONDS : 0.0, (SECONDS > 0.0) ? GAME_COUNT / SECONDS : 0.0);
+    return (pArchive->entryCount > 0 && mismatchCount == 0) ? 0 : -1;
+}
+
+// Append every game in the replay file to the archive
+// Return the process exit code
+static int PackReplays(const char * pPath, const char * pArchivePath)
+{
+    FILE * pFile = fopen(pPath, "r");
+    if(!pFile)
+    {
+        printf("Cannot open replay file: %s\n", pPath);
+        return -1;
+    }
+    ArchiveWriter writer;
+    if(!ArchiveWriterOpen(&writer, pArchivePath))
+    {
+        printf("Cannot open archive: %s\n", pArchivePath);
+        fclose(pFile);
+        return -1;
+    }
+
+    Replay replay;
+    memset(&replay, 0, sizeof(Replay));
+    uint count = 0;
+    BOOL isWritten = TRUE;
+    while(isWritten && ReplayRead(pFile, &replay))
+    {
+        isWritten = ArchiveWriterAppend(&writer, &replay);
+        count += isWritten;
+    }
+    const uint TOTAL = writer.entryCount;
+    isWritten = ArchiveWriterClose(&writer) && isWritten;
+    ReplayFree(&replay);
+    fclose(pFile);
+
+    printf("pack: games=%u total=%u\n", count, TOTAL);
+    return isWritten ? 0 : -1;
+}
+
+// Play every game in the replay file 'repeat' times without a window
+// Archives are detected by their header, anything else is read as text
+// Used for profile-guided builds and as a simulation benchmark
+// Return the process exit code
+static int RunHeadless(const char * pPath, const uint repeat)
+{
+    Archive archive;
+    if(ArchiveOpen(&archive, pPath))
+    {
+        const int EXIT_CODE = RunArchive(&archive, repeat);
+        ArchiveClose(&archive);
+        return EXIT_CODE;
+    }
+
+    FILE * pFile = fopen(pPath, "r");
+    if(!pFile)
+    {
+        printf("Cannot open replay file: %s\n", pPath);
+        return -1;
+    }
+
+    // Load all games up front so that file parsing is not measured
+    Replay * pReplayArr = NULL;
+    uint count = 0;
+    for(;;)
+    {
+        Replay * pNewArr = (Replay *)realloc(pReplayArr, (count + 1) * sizeof(Replay));
+        if(!pNewArr)
+        {
+            break;
+        }
+        pReplayArr = pNewArr;
+        memset(&pReplayArr[count], 0, sizeof(Replay));
+        if(!ReplayRead(pFile, &pReplayArr[count]))
+        {
+            ReplayFree(&pReplayArr[count]);
+            break;
+        }
+        count++;
+    }
+    fclose(pFile);
+
+    uint mismatchCount = 0;
+    unsigned long long tickCount = 0;
+    const clock_t START = clock();
+    for(uint r = 0; r < repeat; r++)
+    {
+        for(uint i = 0; i < count; i++)
+        {
+            if(!ReplayPlay(&pReplayArr[i]))
+            {
+                mismatchCount++;
+            }
+            tickCount += SimulationGetTickCount();
+        }
+    }
+    const double SECONDS = (double)(clock() - START) / CLOCKS_PER_SEC;
+    SimulationFree();
+
+    const unsigned long long GAME_COUNT = (unsigned long long)count * repeat;
+    printf("replay: games=%u repeat=%u ticks=%llu mismatches=%u time=%.3fs ticks/sec=%.0f games/sec=%.0f\n",
+           count, repeat, tickCount, mismatchCount, SECONDS,
+           (SECONDS > 0.0) ? tickCount / SECONDS : 0.0, (SECONDS > 0.0) ? GAME_COUNT / SECONDS : 0.0);
+
+    for(uint i = 0; i < count; i++)
+    {
+        ReplayFree(&pReplayArr[i]);
+    }
+    free(pReplayArr);
+    return (count > 0 && mismatchCount == 0) ? 0 : -1;
+}
+
+// Print a binary event log as text
+// Return the process exit code
+static int DecodeEvents(const char * pPath)
+{
+    FILE * pFile = fopen(pPath, "rb");
+    if(!pFile)
+    {
+        printf("Cannot open event log: %s\n", pPath);
+        return -1;
+    }
+    const BOOL IS_DECODED = EventLogDecode(pFile, stdout);
+    fclose(pFile);
+    if(!IS_DECODED)
+    {
+        printf("Not an event log: %s\n", pPath);
+    }
+    return IS_DECODED ? 0 : -1;
+}
 
 int main(int argc, char * argv[])
 {
+    // Command line options
+    // --software        draw into a CPU framebuffer instead of using SDL_Renderer primitives
+    // --frame-stats     print the average and longest frame time of the renderer on exit
+    // --record <file>   append every finished game to the replay file (archive if it ends in .rsa)
+    // --replay <file>   play the replay file or archive back without a window and exit
+    // --pack <archive>  with --replay, append the games of the text replay file to an archive
+    // --repeat <n>      number of times the replay file is played back
+    // --events <file>   log gameplay events to a binary file, rotated to <file>.1 when it grows large
+    // --spectate <socket> serve the game to spectators on a Unix domain socket, see spectator.h
+    // --decode-events <file> print a binary event log as text and exit
+    // --single-thread   run the simulation in the game loop instead of its own thread
+    // --slow-render <ms> wait after every frame and print the tick jitter on exit
+    // --snake <rects|flowing|cached|mesh|smooth> how the snake is drawn, see snakecache.h and snakemesh.h
+    // --interpolate     move the snake's head and tail smoothly between ticks, drawing at the display refresh rate
+    // --wrap            the snake leaves the board on one edge and comes back on the opposite one
+    // --latency         show input-to-present latency histograms and print them on exit, see latency.h
+    // --vsync           wait for the display's vertical blank when presenting frames
+    // --particle-stress <n> keep n particles alive and print their update and draw time on exit, see particles.h
+    // --board <w>x<h>   play on a board of w by h cells, followed by the camera when larger than the window
+    // --zoom <f>        draw cells f times CELL_SIZE, see camera.h
+    // --autoplay <s>    play by itself for s seconds and exit, see GameSetAutoplay()
+    RendererBackend backend = cBackendAccelerated;
+    SnakeRenderer snakeRenderer = cSnakeRendererRects;
+    BOOL isThreaded = TRUE;
+    BOOL isWrapping = FALSE;
+    BOOL isInterpolating = FALSE;
+    BOOL isTrackingLatency = FALSE;
+    BOOL isVsync = FALSE;
+    BOOL isPrintingFrameStats = FALSE;
+    uint renderDelay = 0;
+    uint particleStress = 0;
+    uint autoplaySeconds = 0;
+    uint boardWidth = BOARD_WIDTH;
+    uint boardHeight = BOARD_HEIGHT;
+    float zoom = 1.0f;
+    const char * pRecordPath = NULL;
+    const char * pReplayPath = NULL;
+    const char * pPackPath = NULL;
+    const char * pEventPath = NULL;
+    const char * pDecodePath = NULL;
+    const char * pSpectatePath = NULL;
+    uint repeat = 1;
+    for(int i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--software") == 0)
+        {
+            backend = cBackendSoftware;
+        }
+        else if(strcmp(argv[i], "--frame-stats") == 0)
+        {
+            isPrintingFrameStats = TRUE;
+        }
+        else if(strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+        {
+            pRecordPath = argv[++i];
+        }
+        else if(strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+        {
+            pReplayPath = argv[++i];
+        }
+        else if(strcmp(argv[i], "--pack") == 0 && i + 1 < argc)
+        {
+            pPackPath = argv[++i];
+        }
+        else if(strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+        {
+            repeat = (uint)strtoul(argv[++i], NULL, 10);
+        }
+        else if(strcmp(argv[i], "--events") == 0 && i + 1 < argc)
+        {
+            pEventPath = argv[++i];
+        }
+        else if(strcmp(argv[i], "--spectate") == 0 && i + 1 < argc)
+        {
+            pSpectatePath = argv[++i];
+        }
+        else if(strcmp(argv[i], "--decode-events") == 0 && i + 1 < argc)
+        {
+            pDecodePath = argv[++i];
+        }
+        else if(strcmp(argv[i], "--single-thread") == 0)
+        {
+            isThreaded = FALSE;
+        }
+        else if(strcmp(argv[i], "--interpolate") == 0)
+        {
+            isInterpolating = TRUE;
+        }
+        else if(strcmp(argv[i], "--wrap") == 0)
+        {
+            isWrapping = TRUE;
+        }
+        else if(strcmp(argv[i], "--latency") == 0)
+        {
+            isTrackingLatency = TRUE;
+        }
+        else if(strcmp(argv[i], "--vsync") == 0)
+        {
+            isVsync = TRUE;
+        }
+        else if(strcmp(argv[i], "--particle-stress") == 0 && i + 1 < argc)
+        {
+            particleStress = (uint)strtoul(argv[++i], NULL, 10);
+        }
+        else if(strcmp(argv[i], "--board") == 0 && i + 1 < argc)
+        {
+            if(sscanf(argv[++i], "%ux%u", &boardWidth, &boardHeight) != 2 || boardWidth < MIN_BOARD_SIZE
+               || boardHeight < MIN_BOARD_SIZE || boardWidth > MAX_BOARD_SIZE || boardHeight > MAX_BOARD_SIZE)
+            {
+                printf("Invalid board size: %s\n", argv[i]);
+                return -1;
+            }
+        }
+        else if(strcmp(argv[i], "--zoom") == 0 && i + 1 < argc)
+        {
+            zoom = (float)strtod(argv[++i], NULL);
+        }
+        else if(strcmp(argv[i], "--autoplay") == 0 && i + 1 < argc)
+        {
+            autoplaySeconds = (uint)strtoul(argv[++i], NULL, 10);
+        }
+        else if(strcmp(argv[i], "--slow-render") == 0 && i + 1 < argc)
+        {
+            renderDelay = (uint)strtoul(argv[++i], NULL, 10);
+        }
+        else if(strcmp(argv[i], "--snake") == 0 && i + 1 < argc)
+        {
+            i++;
+            snakeRenderer = (strcmp(argv[i], "flowing") == 0) ? cSnakeRendererFlowing
+                          : (strcmp(argv[i], "cached") == 0)  ? cSnakeRendererCached
+                          : (strcmp(argv[i], "mesh") == 0)    ? cSnakeRendererMesh
+                          : (strcmp(argv[i], "smooth") == 0)  ? cSnakeRendererSmooth
+                          : cSnakeRendererRects;
+        }
+    }
+
+    if(pDecodePath)
+    {
+        return DecodeEvents(pDecodePath);
+    }
+    if(pReplayPath && pPackPath)
+    {
+        return PackReplays(pReplayPath, pPackPath);
+    }
+    if(pReplayPath)
+    {
+        return RunHeadless(pReplayPath, repeat);
+    }
+
+#ifdef ALLOC_TRACKING
+    AllocTrackInitialise();
+#endif // ALLOC_TRACKING
     SDL_Init(SDL_INIT_VIDEO);
+#ifdef TRACE
+    TraceInitialise();
+#endif // TRACE
 
     // Seed RNG
     time_t t;
     srand((unsigned) time(&t));
 
-    if(!RendererInitialise())
+    RendererSetVsync(isVsync);
+    if(!RendererInitialise(backend))
     {
         SDL_Quit();
         return -1;
     }
+    GameSetBoardSize((ushort)boardWidth, (ushort)boardHeight);
+    CameraSetZoom(zoom);
     GameInitialise();
+    GameSetThreaded(isThreaded);
+    GameSetRenderDelay(renderDelay);
+    GameSetInterpolation(isInterpolating);
+    GameTrackLatency(isTrackingLatency);
+    GameSetParticleStress(particleStress);
+    GameSetAutoplay(autoplaySeconds);
+    SnakeSetRenderer(snakeRenderer);
+    SimulationSetWrapping(isWrapping);
+    if(pRecordPath && !GameRecordReplays(pRecordPath))
+    {
+        printf("Cannot open replay file: %s\n", pRecordPath);
+    }
+    if(pEventPath && !GameLogEvents(pEventPath))
+    {
+        printf("Cannot open event log: %s\n", pEventPath);
+    }
+    if(pSpectatePath && !GameServeSpectators(pSpectatePath))
+    {
+        printf("Cannot open spectator socket: %s\n", pSpectatePath);
+    }
 
     // GameRun() will execute until the internal state is 'exit'
     GameRun();
 
     // Free all resources
     GameFree();
+    if(isPrintingFrameStats)
+    {
+        RendererPrintFrameStats(stdout);
+    }
+#ifdef TRACE
+    if(!TraceExport(TRACE_FILE))
+    {
+        printf("Cannot write trace file: %s\n", TRACE_FILE);
+    }
+    TraceFree();
+#endif // TRACE
     RendererFree();
     SDL_Quit();
+#ifdef ALLOC_TRACKING
+    AllocTrackPrint(stdout);
+    if(AllocTrackHasSteadyAllocations())
+    {
+        printf("Steady-state frames allocated memory\n");
+        return -1;
+    }
+#endif // ALLOC_TRACKING
     return 0;
 }
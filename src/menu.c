@@ -9,6 +9,7 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 
 // Shared constants
 #define STRING_TABLE_LENGTH 6
@@ -194,14 +195,17 @@ BOOL MenuUpdate(const SDL_Keycode keycode, GameState * pState)
 }
 
 // New new menu state
-// If new state is different, free and re-initialise
-// otherwise, no op
+// If new state is different, re-create the elements
+// in the existing array, otherwise, no op
 void MenuSetType(const GameState newState)
 {
     if(menuType != newState)
     {
-        MenuFree();
-        MenuInitialise(newState);
+        currentCount     = 0;
+        currentSelection = 0;
+        menuType         = newState;
+        memset(pElementArr, 0, maxCount * sizeof(MenuElement));
+        InitialiseMenuElements();
     }
 }
 
@@ -227,8 +231,8 @@ void MenuDraw(void)
         r.w = windowWidth;
         r.h = windowWidth;
 
-        SDL_SetRenderDrawColor(GetRenderer(), 0, 0, 0, 128);
-        SDL_RenderFillRect(GetRenderer(), &r);
+        RendererSetColour(0, 0, 0, 128);
+        RendererFillRect(&r);
     }
 
     SDL_Color colour;
@@ -319,7 +323,7 @@ static void InitialiseMenuElements(void)
 
         el.area.x = windowWidth / 2;
         el.area.y = y;
-        TTF_SizeText(GetFont(), el.displayName, &el.area.w, &el.area.h);
+        RendererSizeText(el.displayName, &el.area.w, &el.area.h);
         el.state = pMenuStates[i];
         MenuAddElement(el);
     }
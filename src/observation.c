@@ -0,0 +1,266 @@
+#include "observation.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
+#include "snake.h"
+
+// Planes are padded and aligned to the cache line size
+#define CACHE_LINE 64
+
+// Internal variables
+ENGINE_STATE uchar * pBuffer = NULL;
+ENGINE_STATE uchar * pPlanes = NULL;
+ENGINE_STATE uint planeStride;
+ENGINE_STATE ushort width;
+ENGINE_STATE ushort height;
+ENGINE_STATE uint moveCount;
+ENGINE_STATE Point headPoint;
+ENGINE_STATE Point tailPoint;
+ENGINE_STATE Point foodPoint;
+
+// Internal functions
+
+// Return the body stamp for the given move
+// Zero is reserved for empty cells
+static inline uchar StampOf(const uint move)
+{
+    return (uchar)(1 + (move % 255));
+}
+
+// Return the offset of a point within a plane
+static inline uint ToIndex(const Point point)
+{
+    return ((uint)point.y * width) + (uint)point.x;
+}
+
+// Return a pointer to the first cell of the channel plane
+static inline uchar * Plane(const ObservationChannel channel)
+{
+    return pPlanes + ((size_t)channel * planeStride);
+}
+
+// Return TRUE if point is on the board
+static inline BOOL IsPointInBounds(const Point point)
+{
+    return (-1 < point.x && point.x < width)
+        && (-1 < point.y && point.y < height);
+}
+
+// Public functions
+
+// "Constructor"
+// Allocate the planes for the current board and build them
+// Return FALSE if out of memory
+BOOL ObservationInitialise(void)
+{
+    ObservationFree();
+
+    width  = BoardGetWidth();
+    height = BoardGetHeight();
+    planeStride = (((uint)width * height) + CACHE_LINE - 1) & ~(uint)(CACHE_LINE - 1);
+
+    // C99 has no aligned allocation, so over-allocate and align by hand
+    pBuffer = (uchar *)malloc(((size_t)planeStride * cChannelCount) + CACHE_LINE - 1);
+    if(!pBuffer)
+    {
+        ObservationFree();
+        return FALSE;
+    }
+    pPlanes = (uchar *)(((size_t)pBuffer + CACHE_LINE - 1) & ~(size_t)(CACHE_LINE - 1));
+    ObservationRebuild();
+    return TRUE;
+}
+
+// "Destructor"
+void ObservationFree(void)
+{
+    if(pBuffer)
+    {
+        free(pBuffer);
+        pBuffer = NULL;
+    }
+    pPlanes = NULL;
+    planeStride = 0;
+    width  = 0;
+    height = 0;
+}
+
+// Rebuild all planes from the board and snake
+// O(cells + length). Used after a reset; ObservationUpdate() is O(1)
+void ObservationRebuild(void)
+{
+    if(!pPlanes)
+    {
+        return;
+    }
+    if(width != BoardGetWidth() || height != BoardGetHeight())
+    {
+        ObservationInitialise();
+        return;
+    }
+    memset(pPlanes, 0, (size_t)planeStride * cChannelCount);
+
+    uchar * pWall = Plane(cChannelWall);
+    for(ushort y = 0; y < height; y++)
+    {
+        for(ushort x = 0; x < width; x++)
+        {
+            pWall[ToIndex((Point){x, y})] = (BoardGetCell((Point){x, y}) == cTypeWall);
+        }
+    }
+
+    // The head was laid down on the current move, each segment
+    // behind it one move earlier
+    // Right after eating the tail is doubled up; the cell keeps the younger stamp.
+    // Like ObservationUpdate(), the board decides which cells are occupied
+    moveCount = 255;
+    uint age = 0;
+    uchar * pBody = Plane(cChannelBody);
+    for(SnakePart * pCurrent = SnakeGetHead(); pCurrent; pCurrent = pCurrent->pNext, age++)
+    {
+        const uint INDEX = ToIndex(BoardToPoint(pCurrent->index));
+        if(pBody[INDEX] == 0 && BoardGetCellAt(pCurrent->index) == cTypeSnake)
+        {
+            pBody[INDEX] = StampOf(moveCount - (age % 255));
+        }
+    }
+
+    headPoint = BoardToPoint(SnakeGetHead()->index);
+    tailPoint = BoardToPoint(SnakeGetTail()->index);
+    foodPoint = BoardGetFood();
+    Plane(cChannelHead)[ToIndex(headPoint)] = 1;
+    if(IsPointInBounds(foodPoint))
+    {
+        Plane(cChannelFood)[ToIndex(foodPoint)] = 1;
+    }
+}
+
+// Apply the changes made by one simulation tick
+// Only the old tail, old and new head and food cells are touched
+void ObservationUpdate(const TickResult result)
+{
+    if(!pPlanes || result == cTickWarning || result == cTickDefeat)
+    {
+        // The snake did not move
+        return;
+    }
+    moveCount++;
+
+    uchar * pBody = Plane(cChannelBody);
+    uchar * pHead = Plane(cChannelHead);
+    uchar * pFood = Plane(cChannelFood);
+
+    // The tail cell is only vacated if the board says so:
+    // after eating, the tail stays for one more move
+    if(BoardGetCell(tailPoint) != cTypeSnake)
+    {
+        pBody[ToIndex(tailPoint)] = 0;
+    }
+    tailPoint = BoardToPoint(SnakeGetTail()->index);
+
+    pHead[ToIndex(headPoint)] = 0;
+    headPoint = BoardToPoint(SnakeGetHead()->index);
+    pHead[ToIndex(headPoint)] = 1;
+    pBody[ToIndex(headPoint)] = StampOf(moveCount);
+
+    const Point NEW_FOOD = BoardGetFood();
+    if(!PointsAreEqual(NEW_FOOD, foodPoint))
+    {
+        if(IsPointInBounds(foodPoint))
+        {
+            pFood[ToIndex(foodPoint)] = 0;
+        }
+        if(IsPointInBounds(NEW_FOOD))
+        {
+            pFood[ToIndex(NEW_FOOD)] = 1;
+        }
+        foodPoint = NEW_FOOD;
+    }
+}
+
+// Copy a (2 * radius + 1) square window centred on the head into pOut
+// Channel-major like the full planes; cells outside the board read as wall
+// pOut is left untouched if there are no planes
+void ObservationCrop(uchar * pOut, const ushort radius)
+{
+    if(!pPlanes)
+    {
+        return;
+    }
+    const int SIZE = (2 * radius) + 1;
+    memset(pOut, 0, (size_t)SIZE * SIZE * cChannelCount);
+
+    for(int cy = 0; cy < SIZE; cy++)
+    {
+        for(int cx = 0; cx < SIZE; cx++)
+        {
+            const Point POINT = { headPoint.x + cx - radius, headPoint.y + cy - radius };
+            const uint OUT_INDEX = ((uint)cy * SIZE) + (uint)cx;
+            if(!IsPointInBounds(POINT))
+            {
+                pOut[((size_t)cChannelWall * SIZE * SIZE) + OUT_INDEX] = 1;
+                continue;
+            }
+            const uint INDEX = ToIndex(POINT);
+            for(uint c = 0; c < cChannelCount; c++)
+            {
+                pOut[((size_t)c * SIZE * SIZE) + OUT_INDEX] = pPlanes[((size_t)c * planeStride) + INDEX];
+            }
+        }
+    }
+}
+
+// Reduce each channel by 'factor' in both directions into pOut
+// Each output cell is the maximum of its block; the body channel
+// becomes occupancy (0/1) since stamps cannot be combined
+// Output is ceil(width / factor) x ceil(height / factor) per channel
+// pOut is left untouched if there are no planes
+void ObservationDownsample(uchar * pOut, const ushort factor)
+{
+    if(!pPlanes)
+    {
+        return;
+    }
+    const uint OUT_WIDTH  = (width + factor - 1) / factor;
+    const uint OUT_HEIGHT = (height + factor - 1) / factor;
+    memset(pOut, 0, (size_t)OUT_WIDTH * OUT_HEIGHT * cChannelCount);
+
+    for(uint c = 0; c < cChannelCount; c++)
+    {
+        const uchar * pPlane = pPlanes + ((size_t)c * planeStride);
+        uchar * pOutPlane = pOut + ((size_t)c * OUT_WIDTH * OUT_HEIGHT);
+        for(uint y = 0; y < height; y++)
+        {
+            uchar * pOutRow = pOutPlane + ((y / factor) * OUT_WIDTH);
+            for(uint x = 0; x < width; x++)
+            {
+                uchar value = pPlane[(y * width) + x];
+                value = (c == cChannelBody) ? (value != 0) : value;
+                if(value > pOutRow[x / factor])
+                {
+                    pOutRow[x / factor] = value;
+                }
+            }
+        }
+    }
+}
+
+// Return the first plane; channels are ObservationGetPlaneStride() bytes apart
+const uchar * ObservationGetPlanes(void)
+{
+    return pPlanes;
+}
+
+// Return the distance in bytes between two channel planes
+uint ObservationGetPlaneStride(void)
+{
+    return planeStride;
+}
+
+// Return the stamp of the current head, used to turn body stamps into ages
+uchar ObservationGetBodyOffset(void)
+{
+    return StampOf(moveCount);
+}
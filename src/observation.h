@@ -0,0 +1,42 @@
+#ifndef OBSERVATION_H
+#define OBSERVATION_H
+
+#include "types.h"
+#include "simulation.h"
+
+// Observation planes for learning agents
+//
+// One uint8 plane per channel, stored back to back in a single
+// 64-byte aligned buffer: [channel][y][x], planes are
+// ObservationGetPlaneStride() bytes apart.
+//
+// The body channel stores the move on which each segment was laid down
+// (1-255, 0 = empty) rather than its age, so that moving the snake only
+// touches the head and tail cells. The age of a segment is
+//   (ObservationGetBodyOffset() - value + 255) % 255
+// and wraps after 255 moves.
+typedef enum
+{
+    cChannelBody  = 0,
+    cChannelHead  = 1,
+    cChannelFood  = 2,
+    cChannelWall  = 3,
+    cChannelCount = 4,
+} ObservationChannel;
+
+// Main functions
+BOOL ObservationInitialise(void);
+void ObservationFree(void);
+void ObservationUpdate(const TickResult result);
+void ObservationRebuild(void);
+
+// Views
+void ObservationCrop(uchar * pOut, const ushort radius);
+void ObservationDownsample(uchar * pOut, const ushort factor);
+
+// Helper functions
+const uchar * ObservationGetPlanes(void);
+uint ObservationGetPlaneStride(void);
+uchar ObservationGetBodyOffset(void);
+
+#endif // !OBSERVATION_H
@@ -0,0 +1,279 @@
+#include "particles.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "camera.h"
+#include "globals.h"
+#include "renderer.h"
+#include "framebuffer.h"
+
+// Side of the square drawn for a particle, in pixels
+#define PARTICLE_SIZE 3.0f
+
+// Downwards acceleration in pixels per second squared
+#define GRAVITY 400.0f
+
+// Lifetime range in seconds
+#define MIN_LIFETIME 0.5f
+#define MAX_LIFETIME 1.25f
+
+#define PI 3.14159265f
+
+// Particles updated per vector step, the capacity is a multiple of it
+#define PARTICLE_BATCH 8u
+
+// Internal variables for the pool
+// Field arrays of the live particles, packed from index 0
+// Alpha is life * fade, so it falls from 1 to 0 over the lifetime
+static float * pXArr;
+static float * pYArr;
+static float * pVelocityXArr;
+static float * pVelocityYArr;
+static float * pLifeArr;
+static float * pFadeArr;
+static uchar * pColourArr;   // Index into RAINBOW
+static uint    count;
+static Uint32  randomState = 0x9E3779B9u;
+
+// Internal variables for drawing
+// Four vertices per particle, the indices never change
+static SDL_Vertex * pVertexArr;
+static int *        pIndexArr;
+
+// Internal functions
+
+// Return a pseudo-random number (xorshift32)
+// Only used for the look of the effects, so not seeded
+static inline Uint32 NextRandom(void)
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+// Return a pseudo-random number in [0, 1)
+static inline float NextUnit(void)
+{
+    return (float)(NextRandom() >> 8) * (1.0f / 16777216.0f);
+}
+
+// Move the particles and age them
+// The arrays do not overlap and the count is rounded up to a multiple
+// of PARTICLE_BATCH, so the loop vectorises without a scalar remainder.
+// The extra slots hold zeroes or dead particles and are never drawn
+static void Integrate(float * restrict pX, float * restrict pY, float * restrict pVelocityX, float * restrict pVelocityY,
+                      float * restrict pLife, const uint n, const float seconds)
+{
+    const uint BATCHED = (n + PARTICLE_BATCH - 1) & ~(PARTICLE_BATCH - 1);
+    for(uint i = 0; i < BATCHED; i++)
+    {
+        pX[i] += pVelocityX[i] * seconds;
+        pY[i] += pVelocityY[i] * seconds;
+        pVelocityY[i] += GRAVITY * seconds;
+        pLife[i] -= seconds;
+    }
+}
+
+// Remove the dead particles, moving the last live one into each gap
+static void Compact(void)
+{
+    uint i = 0;
+    while(i < count)
+    {
+        if(pLifeArr[i] > 0.0f)
+        {
+            i++;
+            continue;
+        }
+        count--;
+        pXArr[i]         = pXArr[count];
+        pYArr[i]         = pYArr[count];
+        pVelocityXArr[i] = pVelocityXArr[count];
+        pVelocityYArr[i] = pVelocityYArr[count];
+        pLifeArr[i]      = pLifeArr[count];
+        pFadeArr[i]      = pFadeArr[count];
+        pColourArr[i]    = pColourArr[count];
+    }
+}
+
+// Write the quads of all particles
+static void WriteVertices(void)
+{
+    const float SIZE = PARTICLE_SIZE;
+    for(uint i = 0; i < count; i++)
+    {
+        const RGB COLOUR = RAINBOW[pColourArr[i]];
+        const float ALPHA = pLifeArr[i] * pFadeArr[i];
+        const uchar A = (uchar)((ALPHA < 1.0f) ? ALPHA * 255.0f : 255.0f);
+        SDL_Vertex * pVertex = &pVertexArr[i * 4];
+        for(int corner = 0; corner < 4; corner++)
+        {
+            pVertex[corner].position.x  = pXArr[i] + ((corner & 1) ? SIZE : 0.0f);
+            pVertex[corner].position.y  = pYArr[i] + ((corner & 2) ? SIZE : 0.0f);
+            pVertex[corner].color.r     = COLOUR.r;
+            pVertex[corner].color.g     = COLOUR.g;
+            pVertex[corner].color.b     = COLOUR.b;
+            pVertex[corner].color.a     = A;
+            pVertex[corner].tex_coord.x = 0.0f;
+            pVertex[corner].tex_coord.y = 0.0f;
+        }
+    }
+}
+
+// Fill the particles straight into the framebuffer
+static void FillFramebuffer(void)
+{
+    SDL_Rect r;
+    r.w = (int)PARTICLE_SIZE;
+    r.h = (int)PARTICLE_SIZE;
+    for(uint i = 0; i < count; i++)
+    {
+        const RGB COLOUR = RAINBOW[pColourArr[i]];
+        const float ALPHA = pLifeArr[i] * pFadeArr[i];
+        r.x = (int)pXArr[i];
+        r.y = (int)pYArr[i];
+        FramebufferFillRect(&r, FramebufferMakeColour(COLOUR.r, COLOUR.g, COLOUR.b,
+                                                      (uchar)((ALPHA < 1.0f) ? ALPHA * 255.0f : 255.0f)));
+    }
+}
+
+// Public functions
+
+// "Constructor"
+// Allocate the pool and the vertex buffers
+// Return FALSE if out of memory
+BOOL ParticlesInitialise(void)
+{
+    pXArr         = (float *)calloc(PARTICLE_CAPACITY, sizeof(float));
+    pYArr         = (float *)calloc(PARTICLE_CAPACITY, sizeof(float));
+    pVelocityXArr = (float *)calloc(PARTICLE_CAPACITY, sizeof(float));
+    pVelocityYArr = (float *)calloc(PARTICLE_CAPACITY, sizeof(float));
+    pLifeArr      = (float *)calloc(PARTICLE_CAPACITY, sizeof(float));
+    pFadeArr      = (float *)calloc(PARTICLE_CAPACITY, sizeof(float));
+    pColourArr    = (uchar *)malloc(PARTICLE_CAPACITY * sizeof(uchar));
+    if(RendererGetBackend() != cBackendSoftware)
+    {
+        pVertexArr = (SDL_Vertex *)malloc(PARTICLE_CAPACITY * 4 * sizeof(SDL_Vertex));
+        pIndexArr  = (int *)malloc(PARTICLE_CAPACITY * 6 * sizeof(int));
+    }
+    count = 0;
+    if(!pXArr || !pYArr || !pVelocityXArr || !pVelocityYArr || !pLifeArr || !pFadeArr || !pColourArr
+       || (RendererGetBackend() != cBackendSoftware && (!pVertexArr || !pIndexArr)))
+    {
+        ParticlesFree();
+        return FALSE;
+    }
+
+    // Two triangles per quad, see WriteVertices() for the corner order
+    if(pIndexArr)
+    {
+        const int QUAD_INDICES[6] = { 0, 1, 2, 2, 1, 3 };
+        for(uint i = 0; i < PARTICLE_CAPACITY * 6; i++)
+        {
+            pIndexArr[i] = (int)((i / 6) * 4) + QUAD_INDICES[i % 6];
+        }
+    }
+    return TRUE;
+}
+
+// "Destructor"
+void ParticlesFree(void)
+{
+    free(pXArr);
+    free(pYArr);
+    free(pVelocityXArr);
+    free(pVelocityYArr);
+    free(pLifeArr);
+    free(pFadeArr);
+    free(pColourArr);
+    free(pVertexArr);
+    free(pIndexArr);
+    pXArr         = NULL;
+    pYArr         = NULL;
+    pVelocityXArr = NULL;
+    pVelocityYArr = NULL;
+    pLifeArr      = NULL;
+    pFadeArr      = NULL;
+    pColourArr    = NULL;
+    pVertexArr    = NULL;
+    pIndexArr     = NULL;
+    count         = 0;
+}
+
+// Advance all particles by 'seconds' and remove the dead ones
+void ParticlesUpdate(const float seconds)
+{
+    if(count == 0)
+    {
+        return;
+    }
+    Integrate(pXArr, pYArr, pVelocityXArr, pVelocityYArr, pLifeArr, count, seconds);
+    Compact();
+}
+
+// Draw all particles over the frame
+void ParticlesDraw(void)
+{
+    if(count == 0)
+    {
+        return;
+    }
+    if(RendererGetBackend() == cBackendSoftware)
+    {
+        FillFramebuffer();
+        return;
+    }
+    WriteVertices();
+    SDL_RenderGeometry(GetRenderer(), NULL, pVertexArr, (int)(count * 4), pIndexArr, (int)(count * 6));
+}
+
+// Emit 'emitCount' particles from the point (x, y) in random directions
+// at up to 'speed' pixels per second
+void ParticlesEmit(const float x, const float y, const uint emitCount, const float speed)
+{
+    if(!pXArr)
+    {
+        return;
+    }
+    const uint END = (count + emitCount < PARTICLE_CAPACITY) ? count + emitCount : PARTICLE_CAPACITY;
+    for(uint i = count; i < END; i++)
+    {
+        const float ANGLE    = NextUnit() * 2.0f * PI;
+        const float VELOCITY = speed * (0.25f + (0.75f * NextUnit()));
+        const float LIFETIME = MIN_LIFETIME + ((MAX_LIFETIME - MIN_LIFETIME) * NextUnit());
+        pXArr[i]         = x - (PARTICLE_SIZE / 2.0f);
+        pYArr[i]         = y - (PARTICLE_SIZE / 2.0f);
+        pVelocityXArr[i] = cosf(ANGLE) * VELOCITY;
+        pVelocityYArr[i] = sinf(ANGLE) * VELOCITY;
+        pLifeArr[i]      = LIFETIME;
+        pFadeArr[i]      = 1.0f / LIFETIME;
+        pColourArr[i]    = (uchar)(NextRandom() % ARRAY_SIZE(RAINBOW));
+    }
+    count = END;
+}
+
+// Emit particles from the centre of a board cell
+// The cell is placed by the camera, like the snake and the food
+void ParticlesEmitCell(const Point cell, const uint emitCount, const float speed)
+{
+    int offsetX = 0;
+    int offsetY = 0;
+    CameraGetOffset(&offsetX, &offsetY);
+    const int CELL = CameraGetCellSize();
+    ParticlesEmit((float)(offsetX + (cell.x * CELL) + (CELL / 2)),
+                  (float)(offsetY + (cell.y * CELL) + (CELL / 2)), emitCount, speed);
+}
+
+// Remove all particles
+void ParticlesClear(void)
+{
+    count = 0;
+}
+
+// Return the number of live particles
+uint ParticlesGetCount(void)
+{
+    return count;
+}
@@ -0,0 +1,32 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include "types.h"
+
+// Particle effects
+//
+// Particles live in a fixed pool of PARTICLE_CAPACITY, stored as one array
+// per field so the update loops run over plain float arrays and vectorise.
+// Live particles are packed at the start of the arrays; a dead one is
+// replaced by the last live one. Nothing is allocated after
+// ParticlesInitialise(), and emitting into a full pool drops the new
+// particles. All particles are submitted in one SDL_RenderGeometry() call,
+// or filled straight into the framebuffer by the software backend.
+// Positions are in window pixels and colours come from RAINBOW.
+// Particles emitted from a cell stay where they were emitted when the
+// camera moves, see camera.h
+#define PARTICLE_CAPACITY (1u << 17)
+
+// Main functions
+BOOL ParticlesInitialise(void);
+void ParticlesFree(void);
+void ParticlesUpdate(const float seconds);
+void ParticlesDraw(void);
+
+// Helper functions
+void ParticlesEmit(const float x, const float y, const uint emitCount, const float speed);
+void ParticlesEmitCell(const Point cell, const uint emitCount, const float speed);
+void ParticlesClear(void);
+uint ParticlesGetCount(void);
+
+#endif // !PARTICLES_H
@@ -0,0 +1,272 @@
+#include "rainbowsnake.h"
+
+#include <stdlib.h>
+
+#include "board.h"
+#include "globals.h"
+#include "snake.h"
+#include "simulation.h"
+#include "observation.h"
+#include "space.h"
+
+// Opaque game handle
+// The engine state itself lives in the board, snake and simulation modules
+struct RainbowSnakeGame
+{
+    RainbowSnakeBoard       board;
+    RainbowSnakeObservation observation;
+    BOOL                    hasObservation;
+    BOOL                    hasSpace;
+    int32_t                 lastResult;
+};
+
+// Internal variables
+// The engine state is per thread in the library build (see ENGINE_STATE),
+// and so is the game that owns it
+ENGINE_STATE RainbowSnakeGame * pActiveGame = NULL;
+
+// Internal functions
+
+// Refresh the board view after the board has been (re)initialised
+// The view starts at the first board row, below the top wall row
+static void UpdateBoardView(RainbowSnakeGame * pGame)
+{
+    pGame->board.pCells     = BoardGetCells() + BoardGetRowStride();
+    pGame->board.width      = BoardGetWidth();
+    pGame->board.height     = BoardGetHeight();
+    pGame->board.rowStride  = BoardGetRowStride();
+    pGame->board.cellFormat = (BOARD_CELL_BITS == 2) ? RAINBOWSNAKE_CELLS_PACKED2 : RAINBOWSNAKE_CELLS_UINT8;
+}
+
+// Refresh the observation view after the planes have been updated
+static void UpdateObservationView(RainbowSnakeGame * pGame)
+{
+    pGame->observation.pPlanes      = ObservationGetPlanes();
+    pGame->observation.width        = BoardGetWidth();
+    pGame->observation.height       = BoardGetHeight();
+    pGame->observation.channelCount = cChannelCount;
+    pGame->observation.planeStride  = ObservationGetPlaneStride();
+    pGame->observation.bodyOffset   = ObservationGetBodyOffset();
+}
+
+// Return TRUE if the direction is one of the four valid values
+static BOOL IsDirectionValid(const int32_t direction)
+{
+    return direction == cDirectionUp   || direction == cDirectionDown
+        || direction == cDirectionLeft || direction == cDirectionRight;
+}
+
+// Start maintaining the reachable space regions
+static void EnsureSpace(RainbowSnakeGame * pGame)
+{
+    if(!pGame->hasSpace)
+    {
+        SpaceInitialise();
+        pGame->hasSpace = TRUE;
+    }
+}
+
+// Public functions
+
+// Return the interface version the library was built with
+uint32_t RainbowSnakeGetVersion(void)
+{
+    return RAINBOWSNAKE_VERSION;
+}
+
+// Create a game with the given board size and food seed
+// Return NULL if the size is invalid, out of memory or the thread's game is alive
+RainbowSnakeGame * RainbowSnakeCreate(const uint32_t width, const uint32_t height, const uint32_t seed)
+{
+    // The snake starts 3 cells long in the middle of the board
+    if(pActiveGame || width < 4 || height < 1 || width > MAX_BOARD_SIZE || height > MAX_BOARD_SIZE)
+    {
+        return NULL;
+    }
+
+    RainbowSnakeGame * pGame = (RainbowSnakeGame *)calloc(1, sizeof(RainbowSnakeGame));
+    if(!pGame)
+    {
+        return NULL;
+    }
+    if(!SimulationReset((ushort)width, (ushort)height, seed))
+    {
+        SimulationFree();
+        free(pGame);
+        return NULL;
+    }
+    pActiveGame = pGame;
+    UpdateBoardView(pGame);
+    pGame->lastResult = RAINBOWSNAKE_STEP_MOVED;
+    return pGame;
+}
+
+// Start a new game on the same board
+// The cell buffer is reused, so the board view stays valid
+// Return 0 if out of memory, the game is then left as a defeat
+int32_t RainbowSnakeReset(RainbowSnakeGame * pGame, const uint32_t seed)
+{
+    if(!SimulationReset((ushort)pGame->board.width, (ushort)pGame->board.height, seed))
+    {
+        pGame->lastResult = RAINBOWSNAKE_STEP_DEFEAT;
+        return 0;
+    }
+    UpdateBoardView(pGame);
+    if(pGame->hasObservation)
+    {
+        ObservationRebuild();
+        UpdateObservationView(pGame);
+    }
+    if(pGame->hasSpace)
+    {
+        SpaceRebuild();
+    }
+    pGame->lastResult = RAINBOWSNAKE_STEP_MOVED;
+    return 1;
+}
+
+// Queue the direction (if valid) and advance the game by one tick
+// Once the game has ended, the final result is returned without ticking
+int32_t RainbowSnakeStep(RainbowSnakeGame * pGame, const int32_t direction)
+{
+    if(pGame->lastResult == RAINBOWSNAKE_STEP_DEFEAT || pGame->lastResult == RAINBOWSNAKE_STEP_VICTORY)
+    {
+        return pGame->lastResult;
+    }
+
+    if(IsDirectionValid(direction))
+    {
+        SnakeSetDirection((Direction)direction);
+    }
+    pGame->lastResult = (int32_t)SimulationTick();
+    if(pGame->hasObservation)
+    {
+        ObservationUpdate((TickResult)pGame->lastResult);
+        pGame->observation.bodyOffset = ObservationGetBodyOffset();
+    }
+    if(pGame->hasSpace)
+    {
+        SpaceUpdate((TickResult)pGame->lastResult);
+    }
+    return pGame->lastResult;
+}
+
+// Free the game and the engine state
+void RainbowSnakeDestroy(RainbowSnakeGame * pGame)
+{
+    if(!pGame)
+    {
+        return;
+    }
+    SimulationFree();
+    ObservationFree();
+    SpaceFree();
+    if(pActiveGame == pGame)
+    {
+        pActiveGame = NULL;
+    }
+    free(pGame);
+}
+
+// Return the view of the board cells
+const RainbowSnakeBoard * RainbowSnakeGetBoard(const RainbowSnakeGame * pGame)
+{
+    return &pGame->board;
+}
+
+// Return the observation planes, or NULL if out of memory
+// The first call builds them; after that they are updated on every step
+const RainbowSnakeObservation * RainbowSnakeGetObservation(RainbowSnakeGame * pGame)
+{
+    if(!pGame->hasObservation)
+    {
+        if(!ObservationInitialise())
+        {
+            return NULL;
+        }
+        UpdateObservationView(pGame);
+        pGame->hasObservation = TRUE;
+    }
+    return &pGame->observation;
+}
+
+// Copy a square window of the observation centred on the head
+void RainbowSnakeGetObservationCrop(const RainbowSnakeGame * pGame, const uint32_t radius, uint8_t * pOut)
+{
+    if(pGame->hasObservation && ObservationGetPlanes())
+    {
+        ObservationCrop(pOut, (ushort)radius);
+    }
+}
+
+// Copy the observation reduced by 'factor' in both directions
+void RainbowSnakeGetObservationDownsampled(const RainbowSnakeGame * pGame, const uint32_t factor, uint8_t * pOut)
+{
+    if(pGame->hasObservation && ObservationGetPlanes() && factor > 0)
+    {
+        ObservationDownsample(pOut, (ushort)factor);
+    }
+}
+
+// Return the current score
+uint32_t RainbowSnakeGetScore(const RainbowSnakeGame * pGame)
+{
+    (void)pGame;
+    return SimulationGetScore();
+}
+
+// Return the snake length in cells
+uint32_t RainbowSnakeGetLength(const RainbowSnakeGame * pGame)
+{
+    (void)pGame;
+    return SnakeGetLength();
+}
+
+// Return the number of ticks since the last reset
+uint32_t RainbowSnakeGetTickCount(const RainbowSnakeGame * pGame)
+{
+    (void)pGame;
+    return SimulationGetTickCount();
+}
+
+// Return the head position
+void RainbowSnakeGetHead(const RainbowSnakeGame * pGame, int32_t * pX, int32_t * pY)
+{
+    (void)pGame;
+    const Point HEAD = BoardToPoint(SnakeGetHead()->index);
+    *pX = HEAD.x;
+    *pY = HEAD.y;
+}
+
+// Return the directions the next step can take without a collision
+uint32_t RainbowSnakeGetSafeMoves(const RainbowSnakeGame * pGame)
+{
+    (void)pGame;
+    return SimulationGetSafeMoves();
+}
+
+// Return the number of open cells the cell is connected to, itself included
+// The first call builds the regions; after that they are updated on every step
+uint32_t RainbowSnakeGetRegionSize(RainbowSnakeGame * pGame, const int32_t x, const int32_t y)
+{
+    const Point POINT = {x, y};
+    EnsureSpace(pGame);
+    if(!BoardIsCellValid(POINT))
+    {
+        return 0;
+    }
+    return SpaceGetRegionSize(BoardToIndex(POINT));
+}
+
+// Return non-zero if both cells are open and connected
+int32_t RainbowSnakeIsReachable(RainbowSnakeGame * pGame, const int32_t fromX, const int32_t fromY, const int32_t toX, const int32_t toY)
+{
+    const Point FROM = {fromX, fromY};
+    const Point TO   = {toX, toY};
+    EnsureSpace(pGame);
+    if(!BoardIsCellValid(FROM) || !BoardIsCellValid(TO))
+    {
+        return 0;
+    }
+    return SpaceIsReachable(BoardToIndex(FROM), BoardToIndex(TO));
+}
@@ -0,0 +1,146 @@
+#ifndef RAINBOWSNAKE_H
+#define RAINBOWSNAKE_H
+
+// Embeddable game library (librainbowsnake.so)
+//
+// Stable C interface over the game logic, without SDL.
+// Only fixed-width types are used and structures are only ever extended
+// at the end, so harnesses built against an older header keep working.
+//
+// The engine keeps its state in thread-local variables, so every thread
+// can run one game of its own (see RainbowSnakeCreate()).
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_WIN32)
+#define RAINBOWSNAKE_API __declspec(dllexport)
+#elif defined(__GNUC__)
+#define RAINBOWSNAKE_API __attribute__((visibility("default")))
+#else
+#define RAINBOWSNAKE_API
+#endif
+
+// Interface version, incremented when functions or fields are added
+#define RAINBOWSNAKE_VERSION 5
+
+// Cell values (same as Celltype)
+#define RAINBOWSNAKE_CELL_FREE  0
+#define RAINBOWSNAKE_CELL_WALL  1
+#define RAINBOWSNAKE_CELL_SNAKE 2
+#define RAINBOWSNAKE_CELL_FOOD  3
+
+// Cell storage formats
+// PACKED2 stores four cells per byte, the leftmost cell in the lowest two bits
+#define RAINBOWSNAKE_CELLS_UINT8   1
+#define RAINBOWSNAKE_CELLS_PACKED2 2
+
+// Observation channels (same as ObservationChannel)
+#define RAINBOWSNAKE_CHANNEL_BODY  0
+#define RAINBOWSNAKE_CHANNEL_HEAD  1
+#define RAINBOWSNAKE_CHANNEL_FOOD  2
+#define RAINBOWSNAKE_CHANNEL_WALL  3
+#define RAINBOWSNAKE_CHANNEL_COUNT 4
+
+// Directions (same as Direction)
+// RAINBOWSNAKE_DIRECTION_NONE keeps the current direction
+#define RAINBOWSNAKE_DIRECTION_UP    0
+#define RAINBOWSNAKE_DIRECTION_DOWN  1
+#define RAINBOWSNAKE_DIRECTION_LEFT  3
+#define RAINBOWSNAKE_DIRECTION_RIGHT 4
+#define RAINBOWSNAKE_DIRECTION_NONE  -1
+
+// Safe-move mask bits (since version 3)
+#define RAINBOWSNAKE_MOVE_UP    0x1
+#define RAINBOWSNAKE_MOVE_DOWN  0x2
+#define RAINBOWSNAKE_MOVE_LEFT  0x4
+#define RAINBOWSNAKE_MOVE_RIGHT 0x8
+
+// Step results (same as TickResult)
+#define RAINBOWSNAKE_STEP_MOVED   0
+#define RAINBOWSNAKE_STEP_ATE     1
+#define RAINBOWSNAKE_STEP_WARNING 2
+#define RAINBOWSNAKE_STEP_DEFEAT  3
+#define RAINBOWSNAKE_STEP_VICTORY 4
+
+typedef struct RainbowSnakeGame RainbowSnakeGame;
+
+// View of the board cells
+// 'pCells' points straight at the engine's cell buffer; it is not copied
+// and stays valid until the game is destroyed or reset with another size
+typedef struct
+{
+    const void * pCells;
+    uint32_t     width;
+    uint32_t     height;
+    uint32_t     rowStride;   // Bytes between the starts of two rows
+    uint32_t     cellFormat;  // RAINBOWSNAKE_CELLS_*
+} RainbowSnakeBoard;
+
+// Observation planes for learning agents (since version 2)
+// One uint8 plane per channel in a 64-byte aligned buffer, 'planeStride'
+// bytes apart. The planes are updated in place on every step.
+// Body cells hold the move they were laid down on (1-255, 0 = empty);
+// a segment's age is (bodyOffset - value + 255) % 255
+typedef struct
+{
+    const uint8_t * pPlanes;
+    uint32_t        width;
+    uint32_t        height;
+    uint32_t        channelCount;
+    uint32_t        planeStride;
+    uint32_t        bodyOffset;
+} RainbowSnakeObservation;
+
+RAINBOWSNAKE_API uint32_t RainbowSnakeGetVersion(void);
+
+// Game functions
+// Every thread owns at most one game: RainbowSnakeCreate() returns NULL
+// while the calling thread's game is alive. Games on different threads
+// run in parallel and share nothing, but a game must only be used, and
+// destroyed, by the thread that created it.
+// Boards are 4 to 1024 cells wide and 1 to 1024 cells high; Create returns
+// NULL for other sizes or if the board cannot be allocated.
+// Reset returns 0 if it ran out of memory (since version 5); the game has
+// then ended and can only be reset again or destroyed
+RAINBOWSNAKE_API RainbowSnakeGame * RainbowSnakeCreate(const uint32_t width, const uint32_t height, const uint32_t seed);
+RAINBOWSNAKE_API int32_t RainbowSnakeReset(RainbowSnakeGame * pGame, const uint32_t seed);
+RAINBOWSNAKE_API int32_t RainbowSnakeStep(RainbowSnakeGame * pGame, const int32_t direction);
+RAINBOWSNAKE_API void RainbowSnakeDestroy(RainbowSnakeGame * pGame);
+
+RAINBOWSNAKE_API const RainbowSnakeBoard * RainbowSnakeGetBoard(const RainbowSnakeGame * pGame);
+RAINBOWSNAKE_API uint32_t RainbowSnakeGetScore(const RainbowSnakeGame * pGame);
+RAINBOWSNAKE_API uint32_t RainbowSnakeGetLength(const RainbowSnakeGame * pGame);
+RAINBOWSNAKE_API uint32_t RainbowSnakeGetTickCount(const RainbowSnakeGame * pGame);
+RAINBOWSNAKE_API void RainbowSnakeGetHead(const RainbowSnakeGame * pGame, int32_t * pX, int32_t * pY);
+
+// Safe-move functions (since version 3)
+// Return RAINBOWSNAKE_MOVE_* bits for the directions that the next step can take
+// without a collision. Asking to turn back keeps the current direction, so
+// that bit is the same as the bit of going straight
+RAINBOWSNAKE_API uint32_t RainbowSnakeGetSafeMoves(const RainbowSnakeGame * pGame);
+
+// Reachable space functions (since version 4)
+// Regions are only maintained once one of these has been called.
+// A cell is open if it is free or food; cells that are not open,
+// or not on the board, have a region size of 0 and reach nothing
+RAINBOWSNAKE_API uint32_t RainbowSnakeGetRegionSize(RainbowSnakeGame * pGame, const int32_t x, const int32_t y);
+RAINBOWSNAKE_API int32_t RainbowSnakeIsReachable(RainbowSnakeGame * pGame, const int32_t fromX, const int32_t fromY, const int32_t toX, const int32_t toY);
+
+// Observation functions (since version 2)
+// Observations are only maintained once RainbowSnakeGetObservation() has been called,
+// which returns NULL if the planes cannot be allocated; crop and downsample then write nothing.
+// Crop writes channelCount * (2 * radius + 1)^2 bytes centred on the head,
+// downsample writes channelCount * ceil(width / factor) * ceil(height / factor) bytes
+RAINBOWSNAKE_API const RainbowSnakeObservation * RainbowSnakeGetObservation(RainbowSnakeGame * pGame);
+RAINBOWSNAKE_API void RainbowSnakeGetObservationCrop(const RainbowSnakeGame * pGame, const uint32_t radius, uint8_t * pOut);
+RAINBOWSNAKE_API void RainbowSnakeGetObservationDownsampled(const RainbowSnakeGame * pGame, const uint32_t factor, uint8_t * pOut);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !RAINBOWSNAKE_H
@@ -2,16 +2,87 @@
 #include <stdio.h>
 
 #include "globals.h"
+#include "framebuffer.h"
+#include "glyphatlas.h"
+#include "trace.h"
 
 // "Private" variables
 static SDL_Window * pWindow = NULL;
 static SDL_Renderer * pRenderer = NULL;
-static TTF_Font * pFont = NULL;
+static TTF_Font * pFont = NULL;  // Only opened for text the glyph atlas cannot draw
+static BOOL isFontBroken = FALSE;
+static RendererBackend activeBackend = cBackendAccelerated;
+static BOOL isVsync = FALSE;  // Wait for the display's vertical blank in SDL_RenderPresent()
+static Uint32 drawColour = 0;
+
+// Frame time statistics, from RendererClear() to the end of RendererDraw()
+// Kept in every build so the backends can be compared, see RendererPrintFrameStats()
+static Uint64 frameStartTime;
+static Uint64 frameTimeTotal;
+static Uint64 frameTimeMax;
+static uint   frameCount;
+
+#ifdef DEBUG
+static BOOL isFirstFrameDrawn;
+#endif // DEBUG
+
+// Match the framebuffer to the window size
+// The window can change size after it is created, when it is maximised,
+// made fullscreen or resized, so this is checked before every frame
+// Return FALSE if the framebuffer cannot be created
+static BOOL ResizeFramebuffer(void)
+{
+    int windowWidth = 0;
+    int windowHeight = 0;
+    int bufferWidth = 0;
+    int bufferHeight = 0;
+    SDL_GetWindowSize(pWindow, &windowWidth, &windowHeight);
+    FramebufferGetSize(&bufferWidth, &bufferHeight);
+    if(windowWidth == bufferWidth && windowHeight == bufferHeight)
+    {
+        return TRUE;
+    }
+    return FramebufferInitialise(pRenderer, windowWidth, windowHeight);
+}
+
+// Create the renderer for the requested backend
+// The software backend only needs SDL to blit a single texture per frame,
+// so it asks for SDL's software renderer instead of a GPU driver
+static BOOL CreateBackend(const RendererBackend backend)
+{
+    if(backend == cBackendSoftware)
+    {
+        pRenderer = SDL_CreateRenderer(pWindow, -1, SDL_RENDERER_SOFTWARE | (isVsync ? SDL_RENDERER_PRESENTVSYNC : 0));
+        if(!pRenderer)
+        {
+            return FALSE;
+        }
+
+        if(!ResizeFramebuffer())
+        {
+            SDL_DestroyRenderer(pRenderer);
+            pRenderer = NULL;
+            return FALSE;
+        }
+    }
+    else
+    {
+        pRenderer = SDL_CreateRenderer(pWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_TARGETTEXTURE | (isVsync ? SDL_RENDERER_PRESENTVSYNC : 0));
+        if(!pRenderer)
+        {
+            return FALSE;
+        }
+        SDL_SetRenderDrawBlendMode(pRenderer, SDL_BLENDMODE_BLEND);
+    }
+    activeBackend = backend;
+    return TRUE;
+}
 
 // Create the game window.
-// Initialise the font and renderer
+// Initialise the renderer and the glyph atlas
+// If the accelerated renderer cannot be created, fall back to software
 // Return false if initialisation fails
-BOOL RendererInitialise(void)
+BOOL RendererInitialise(const RendererBackend backend)
 {
 // In debug mode, create borderless fullscreen
 // Otherwise the fullscreen will fuck with
@@ -32,19 +103,11 @@ BOOL RendererInitialise(void)
     {
         goto InitialiseRenderer_error;
     }
-    pRenderer = SDL_CreateRenderer(pWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_TARGETTEXTURE);
-    if(!pRenderer)
+    if(!CreateBackend(backend) && (backend == cBackendSoftware || !CreateBackend(cBackendSoftware)))
     {
         goto InitialiseRenderer_error;
     }
-    SDL_SetRenderDrawBlendMode(pRenderer, SDL_BLENDMODE_BLEND);
-    if(TTF_Init() != 0)
-    {
-        goto InitialiseRenderer_error;
-    }
-
-    pFont = TTF_OpenFont("font.ttf", 32);
-    if(!pFont)
+    if(!GlyphAtlasInitialise())
     {
         goto InitialiseRenderer_error;
     }
@@ -63,7 +126,11 @@ void RendererFree(void)
     if(pFont)
     {
         TTF_CloseFont(pFont);
+        TTF_Quit();
+        pFont = NULL;
     }
+    GlyphAtlasFree();
+    FramebufferFree();
     if(pRenderer)
     {
         SDL_DestroyRenderer(pRenderer);
@@ -77,14 +144,63 @@ void RendererFree(void)
 // Clear the window screen
 void RendererClear(void)
 {
+    frameStartTime = SDL_GetPerformanceCounter();
+
+    if(activeBackend == cBackendSoftware)
+    {
+        if(!ResizeFramebuffer())
+        {
+            printf("RendererClear error: cannot resize the framebuffer: %s\n", SDL_GetError());
+        }
+        FramebufferClear(FramebufferMakeColour(0, 0, 0, SDL_ALPHA_OPAQUE));
+        return;
+    }
     SDL_SetRenderDrawColor(pRenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
     SDL_RenderClear(pRenderer);
 }
 
 // Draw the present renderer
+// For the software backend, upload the framebuffer first
 void RendererDraw(void)
 {
+    TRACE_BEGIN(RendererDraw);
+    if(activeBackend == cBackendSoftware)
+    {
+        FramebufferPresent(pRenderer);
+    }
     SDL_RenderPresent(pRenderer);
+    TRACE_END(RendererDraw);
+
+#ifdef DEBUG
+    if(!isFirstFrameDrawn)
+    {
+        printf("first frame: %u ms after SDL_Init\n", SDL_GetTicks());
+        isFirstFrameDrawn = TRUE;
+    }
+#endif // DEBUG
+
+    const Uint64 FRAME_TIME = SDL_GetPerformanceCounter() - frameStartTime;
+    frameTimeTotal += FRAME_TIME;
+    frameTimeMax    = (FRAME_TIME > frameTimeMax) ? FRAME_TIME : frameTimeMax;
+    frameCount++;
+}
+
+// Print the average and longest time taken to clear, draw and present
+// a frame with the active backend
+// Run once with --software and once without to compare the backends
+void RendererPrintFrameStats(FILE * pFile)
+{
+    if(frameCount == 0)
+    {
+        return;
+    }
+    const double FREQUENCY = (double)SDL_GetPerformanceFrequency();
+    int windowWidth = 0;
+    int windowHeight = 0;
+    RendererGetWindowSize(&windowWidth, &windowHeight);
+    fprintf(pFile, "%s renderer at %dx%d: %u frames, %.3f ms/frame average, %.3f ms max\n",
+            (activeBackend == cBackendSoftware) ? "software" : "accelerated", windowWidth, windowHeight, frameCount,
+            (double)frameTimeTotal * 1000.0 / FREQUENCY / frameCount, (double)frameTimeMax * 1000.0 / FREQUENCY);
 }
 
 // Return the window size
@@ -96,6 +212,82 @@ void RendererGetWindowSize(int * pW, int * pH)
     }
 }
 
+// Return the refresh rate of the display showing the window
+// Return 0 if it is not known
+int RendererGetRefreshRate(void)
+{
+    SDL_DisplayMode mode;
+    if(!pWindow || SDL_GetCurrentDisplayMode(SDL_GetWindowDisplayIndex(pWindow), &mode) != 0)
+    {
+        return 0;
+    }
+    return mode.refresh_rate;
+}
+
+// Synchronise presents with the display's vertical blank
+// Must be called before RendererInitialise()
+void RendererSetVsync(const BOOL isEnabled)
+{
+    isVsync = isEnabled;
+}
+
+// Return TRUE if the renderer waits for the vertical blank
+// The driver may ignore the request, so ask the renderer
+BOOL RendererIsVsync(void)
+{
+    SDL_RendererInfo info;
+    if(!pRenderer || SDL_GetRendererInfo(pRenderer, &info) != 0)
+    {
+        return FALSE;
+    }
+    return (info.flags & SDL_RENDERER_PRESENTVSYNC) != 0;
+}
+
+// Set the colour used by RendererFillRect() and RendererDrawLine()
+void RendererSetColour(const uchar r, const uchar g, const uchar b, const uchar a)
+{
+    if(activeBackend == cBackendSoftware)
+    {
+        drawColour = FramebufferMakeColour(r, g, b, a);
+        return;
+    }
+    SDL_SetRenderDrawColor(pRenderer, r, g, b, a);
+}
+
+// Fill a rectangle with the current colour
+void RendererFillRect(const SDL_Rect * pRect)
+{
+    if(activeBackend == cBackendSoftware)
+    {
+        FramebufferFillRect(pRect, drawColour);
+        return;
+    }
+    SDL_RenderFillRect(pRenderer, pRect);
+}
+
+// Draw a line with the current colour
+// The software backend only supports horizontal and vertical lines
+void RendererDrawLine(const int x1, const int y1, const int x2, const int y2)
+{
+    if(activeBackend == cBackendSoftware)
+    {
+        SDL_Rect r;
+        r.x = (x1 < x2) ? x1 : x2;
+        r.y = (y1 < y2) ? y1 : y2;
+        r.w = abs(x2 - x1) + 1;
+        r.h = abs(y2 - y1) + 1;
+        FramebufferFillRect(&r, drawColour);
+        return;
+    }
+    SDL_RenderDrawLine(pRenderer, x1, y1, x2, y2);
+}
+
+// Return the active rendering backend
+RendererBackend RendererGetBackend(void)
+{
+    return activeBackend;
+}
+
 // Return pointer to the renderer
 SDL_Renderer * GetRenderer(void)
 {
@@ -103,16 +295,62 @@ SDL_Renderer * GetRenderer(void)
 }
 
 // Return the pointer to the font
+// The font is opened from the embedded font file on the first call
+// Return NULL if SDL_ttf cannot be initialised (only tried once)
 TTF_Font * GetFont(void)
 {
+    if(pFont || isFontBroken)
+    {
+        return pFont;
+    }
+    isFontBroken = TRUE;
+    if(TTF_Init() != 0)
+    {
+        printf("GetFont error: %s\n", TTF_GetError());
+        return NULL;
+    }
+    uint size = 0;
+    const uchar * pData = GlyphAtlasGetFontData(&size);
+    pFont = TTF_OpenFontRW(SDL_RWFromConstMem(pData, (int)size), 1, GlyphAtlasGetPointSize());
+    if(!pFont)
+    {
+        printf("GetFont error: %s\n", TTF_GetError());
+        TTF_Quit();
+        return NULL;
+    }
+    isFontBroken = FALSE;
     return pFont;
 }
 
+// Measure the text as it would be drawn (before title scaling)
+void RendererSizeText(const char * pText, int * pW, int * pH)
+{
+    *pW = 0;
+    *pH = 0;
+    if(GlyphAtlasCanDraw(pText))
+    {
+        GlyphAtlasSizeText(pText, pW, pH);
+    }
+    else if(GetFont())
+    {
+        TTF_SizeText(pFont, pText, pW, pH);
+    }
+}
+
 // Draw selected text
+// Text the glyph atlas can draw does not need SDL_ttf
 void RendererDrawText(char * pText, const SDL_Color colour, const ushort x, const ushort y, const BOOL isTitle)
 {
+    TRACE_BEGIN(RendererDrawText);
+    const BOOL IS_ATLAS_TEXT = GlyphAtlasCanDraw(pText);
+    if(!IS_ATLAS_TEXT && !GetFont())
+    {
+        TRACE_END(RendererDrawText);
+        return;
+    }
+
     SDL_Rect r;
-    TTF_SizeText(pFont, pText, &r.w, &r.h);
+    RendererSizeText(pText, &r.w, &r.h);
 
     if(isTitle)
     {
@@ -129,9 +367,24 @@ void RendererDrawText(char * pText, const SDL_Color colour, const ushort x, cons
         r.y -= (r.h / 2);
     }
 
+    if(IS_ATLAS_TEXT)
+    {
+        GlyphAtlasDraw(pText, colour, &r);
+        TRACE_END(RendererDrawText);
+        return;
+    }
+
     SDL_Surface * pTextSurface = TTF_RenderText_Solid(pFont, pText, colour);
+    if(activeBackend == cBackendSoftware)
+    {
+        FramebufferBlitSurface(pTextSurface, &r);
+        SDL_FreeSurface(pTextSurface);
+        TRACE_END(RendererDrawText);
+        return;
+    }
     SDL_Texture * pTextTexture = SDL_CreateTextureFromSurface(pRenderer, pTextSurface);
     SDL_RenderCopy(pRenderer, pTextTexture, NULL, &r);
     SDL_FreeSurface(pTextSurface);
     SDL_DestroyTexture(pTextTexture);
+    TRACE_END(RendererDrawText);
 }
@@ -3,17 +3,36 @@
 
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
+#include <stdio.h>
 
 #include "types.h"
 
-BOOL RendererInitialise(void);
+// Rendering backend, selected at startup
+// Accelerated draws through SDL_Renderer primitives
+// Software draws into a CPU framebuffer which is uploaded once per frame
+typedef enum
+{
+    cBackendAccelerated = 0,
+    cBackendSoftware    = 1,
+} RendererBackend;
+
+BOOL RendererInitialise(const RendererBackend backend);
 void RendererFree(void);
 void RendererClear(void);
 void RendererDraw(void);
 void RendererGetWindowSize(int * pW, int * pH);
+int RendererGetRefreshRate(void);
+void RendererSetVsync(const BOOL isEnabled);
+BOOL RendererIsVsync(void);
+void RendererPrintFrameStats(FILE * pFile);
+void RendererSetColour(const uchar r, const uchar g, const uchar b, const uchar a);
+void RendererFillRect(const SDL_Rect * pRect);
+void RendererDrawLine(const int x1, const int y1, const int x2, const int y2);
+void RendererSizeText(const char * pText, int * pW, int * pH);
 void RendererDrawText(char * pText, const SDL_Color colour, const ushort x, const ushort y, const BOOL isTitle);
 void RendererDrawTextBlended(char * pText, const SDL_Color colour, const ushort x, const ushort y, const BOOL isTitle);
 
+RendererBackend RendererGetBackend(void);
 SDL_Renderer * GetRenderer(void);
 TTF_Font * GetFont(void);
 
@@ -0,0 +1,181 @@
+#include "replay.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
+#include "globals.h"
+
+// Internal functions
+
+// Return the direction in effect after all recorded inputs
+// The snake always starts moving right
+static Direction ReplayLastDirection(const Replay * pReplay)
+{
+    if(pReplay->inputCount == 0)
+    {
+        return cDirectionRight;
+    }
+    return pReplay->pInputArr[pReplay->inputCount - 1].direction;
+}
+
+// Public functions
+
+// Start recording a new game on the current board
+// Any previously recorded inputs are discarded
+void ReplayRecordBegin(Replay * pReplay, const uint seed)
+{
+    pReplay->seed       = seed;
+    pReplay->width      = BoardGetWidth();
+    pReplay->height     = BoardGetHeight();
+    pReplay->isWrapping = (BoardGetWrapTable() != NULL);
+    pReplay->tickCount  = 0;
+    pReplay->score      = 0;
+    pReplay->result     = cTickMoved;
+    pReplay->inputCount = 0;
+}
+
+// Record the direction queued for the upcoming tick
+// Only changes are stored
+void ReplayRecordTick(Replay * pReplay, const Direction direction)
+{
+    if(direction != ReplayLastDirection(pReplay))
+    {
+        ReplayAddInput(pReplay, pReplay->tickCount, direction);
+    }
+    pReplay->tickCount++;
+}
+
+// Finish recording, storing the final result and score
+void ReplayRecordEnd(Replay * pReplay, const TickResult result)
+{
+    pReplay->result = result;
+    pReplay->score  = SimulationGetScore();
+}
+
+// Append a direction change, growing the input array if needed
+void ReplayAddInput(Replay * pReplay, const uint tick, const Direction direction)
+{
+    if(pReplay->inputCount == pReplay->inputCapacity)
+    {
+        const uint NEW_CAPACITY = (pReplay->inputCapacity == 0) ? 64 : pReplay->inputCapacity * 2;
+        ReplayInput * pNewArr = (ReplayInput *)realloc(pReplay->pInputArr, NEW_CAPACITY * sizeof(ReplayInput));
+        if(!pNewArr)
+        {
+            return;
+        }
+        pReplay->pInputArr     = pNewArr;
+        pReplay->inputCapacity = NEW_CAPACITY;
+    }
+    pReplay->pInputArr[pReplay->inputCount].tick      = tick;
+    pReplay->pInputArr[pReplay->inputCount].direction = direction;
+    pReplay->inputCount++;
+}
+
+// Free the input array
+void ReplayFree(Replay * pReplay)
+{
+    if(pReplay->pInputArr)
+    {
+        free(pReplay->pInputArr);
+    }
+    memset(pReplay, 0, sizeof(Replay));
+}
+
+// Write a game to the file in text format
+// Return FALSE on write error
+BOOL ReplayWrite(FILE * pFile, const Replay * pReplay)
+{
+    fprintf(pFile, "RSREPLAY %d\n", REPLAY_VERSION);
+    fprintf(pFile, "seed %u\n", pReplay->seed);
+    fprintf(pFile, "%s %u %u\n", (pReplay->isWrapping) ? "torus" : "board", pReplay->width, pReplay->height);
+    fprintf(pFile, "ticks %u\n", pReplay->tickCount);
+    fprintf(pFile, "score %u\n", pReplay->score);
+    fprintf(pFile, "result %d\n", (int)pReplay->result);
+    fprintf(pFile, "inputs %u\n", pReplay->inputCount);
+    for(uint i = 0; i < pReplay->inputCount; i++)
+    {
+        fprintf(pFile, "%u %d\n", pReplay->pInputArr[i].tick, (int)pReplay->pInputArr[i].direction);
+    }
+    return !ferror(pFile);
+}
+
+// Read the next game from the file
+// Return FALSE at the end of the file or if the data is malformed
+BOOL ReplayRead(FILE * pFile, Replay * pReplay)
+{
+    int version = 0;
+    char board[8] = "";
+    uint width = 0;
+    uint height = 0;
+    int result = 0;
+    uint inputCount = 0;
+
+    if(fscanf(pFile, " RSREPLAY %d", &version) != 1 || version != REPLAY_VERSION)
+    {
+        return FALSE;
+    }
+    if(fscanf(pFile, " seed %u %7s %u %u ticks %u score %u result %d inputs %u",
+              &pReplay->seed, board, &width, &height, &pReplay->tickCount, &pReplay->score, &result, &inputCount) != 8
+    || (strcmp(board, "board") != 0 && strcmp(board, "torus") != 0)
+    || width < 4 || height < 1 || width > MAX_BOARD_SIZE || height > MAX_BOARD_SIZE)
+    {
+        return FALSE;
+    }
+    pReplay->width      = width;
+    pReplay->height     = height;
+    pReplay->isWrapping = (strcmp(board, "torus") == 0);
+    pReplay->result     = (TickResult)result;
+    pReplay->inputCount = 0;
+
+    for(uint i = 0; i < inputCount; i++)
+    {
+        uint tick = 0;
+        int direction = 0;
+        if(fscanf(pFile, "%u %d", &tick, &direction) != 2)
+        {
+            return FALSE;
+        }
+        ReplayAddInput(pReplay, tick, (Direction)direction);
+    }
+    return pReplay->inputCount == inputCount;
+}
+
+// Play the game back without rendering
+// Return TRUE if the result and score match the recording
+BOOL ReplayPlay(const Replay * pReplay)
+{
+    SimulationSetWrapping(pReplay->isWrapping);
+    if(!SimulationReset(pReplay->width, pReplay->height, pReplay->seed))
+    {
+        return FALSE;
+    }
+
+    TickResult result = cTickMoved;
+    uint next = 0;
+    for(uint tick = 0; tick < pReplay->tickCount; tick++)
+    {
+        while(next < pReplay->inputCount && pReplay->pInputArr[next].tick == tick)
+        {
+            SnakeSetDirection(pReplay->pInputArr[next++].direction);
+        }
+
+#ifdef DEBUG
+        // The safe-move mask has to agree with what the tick does
+        const BOOL IS_PREDICTED_SAFE = (SimulationGetSafeMoves() & SimulationMoveBit(SnakeGetQueuedDirection())) != 0;
+#endif // DEBUG
+        result = SimulationTick();
+#ifdef DEBUG
+        if(IS_PREDICTED_SAFE != (result != cTickWarning && result != cTickDefeat))
+        {
+            printf("Safe-move mask disagrees with tick %u of seed %u\n", tick, pReplay->seed);
+            return FALSE;
+        }
+#endif // DEBUG
+        if(result == cTickDefeat || result == cTickVictory)
+        {
+            break;
+        }
+    }
+    return result == pReplay->result && SimulationGetScore() == pReplay->score;
+}
@@ -0,0 +1,54 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdio.h>
+
+#include "types.h"
+#include "snake.h"
+#include "simulation.h"
+
+// Replay format version
+// Text files are a sequence of games, each starting with the "RSREPLAY" header
+// Version 2: food is picked from the free cells in row-major order.
+// Games on a wrapping board say "torus" instead of "board"
+#define REPLAY_VERSION 2
+
+// A single direction change, applied before the given tick
+typedef struct
+{
+    uint      tick;
+    Direction direction;
+} ReplayInput;
+
+// Recorded game
+// Seed and inputs are enough to reproduce the game exactly,
+// the result and score are stored to verify playback
+typedef struct
+{
+    uint         seed;
+    ushort       width;
+    ushort       height;
+    BOOL         isWrapping;  // See SimulationSetWrapping()
+    uint         tickCount;
+    uint         score;
+    TickResult   result;
+    uint         inputCount;
+    uint         inputCapacity;
+    ReplayInput * pInputArr;
+} Replay;
+
+// Recording functions
+void ReplayRecordBegin(Replay * pReplay, const uint seed);
+void ReplayRecordTick(Replay * pReplay, const Direction direction);
+void ReplayRecordEnd(Replay * pReplay, const TickResult result);
+void ReplayAddInput(Replay * pReplay, const uint tick, const Direction direction);
+void ReplayFree(Replay * pReplay);
+
+// File functions
+BOOL ReplayWrite(FILE * pFile, const Replay * pReplay);
+BOOL ReplayRead(FILE * pFile, Replay * pReplay);
+
+// Playback
+BOOL ReplayPlay(const Replay * pReplay);
+
+#endif // !REPLAY_H
@@ -0,0 +1,468 @@
+#include "simthread.h"
+
+#include <SDL2/SDL.h>
+
+#include "snake.h"
+#include "simulation.h"
+#include "replay.h"
+#include "archive.h"
+#include "eventlog.h"
+#include "board.h"
+#include "spectator.h"
+#include "alloctrack.h"
+
+// Command queue size, must be a power of two
+#define QUEUE_SIZE 64
+
+// Set on the shared triple buffer slot when it holds
+// a snapshot that the reader has not picked up yet
+#define SLOT_FRESH 4
+
+typedef struct
+{
+    SimCommandType type;
+    uint           value;
+    Uint64         time;   // Key press of a direction, 0 if unknown
+} SimCommand;
+
+// Internal variables for the command queue
+// Single producer (game) and single consumer (runner), so
+// each index is only ever written by one side
+static SimCommand   commandArr[QUEUE_SIZE];
+static SDL_atomic_t queueHead;
+static SDL_atomic_t queueTail;
+
+// Internal variables for the triple buffer
+// The writer fills 'backSlot' and swaps it with the shared slot,
+// the reader swaps 'frontSlot' with the shared slot when it is fresh.
+// Neither side ever waits for the other
+static Snapshot     snapshotArr[3];
+static SDL_atomic_t sharedSlot;
+static int          backSlot;
+static int          frontSlot;
+
+// Internal variables for the thread
+static SDL_Thread * pThread;
+static SDL_sem *    pWakeSemaphore;
+static SDL_atomic_t isQuitting;
+
+// Internal variables for the simulation
+// Only used by the runner
+static ushort       boardWidth;
+static ushort       boardHeight;
+static uint         gameId;
+static TickResult   lastResult;
+static BOOL         isActive;
+static BOOL         isPaused;
+static Uint64       tickPeriod;
+static Uint64       deadline;
+static Uint64       moveTime;
+static Point        vacatedPoint;
+static Uint64       pendingInputTime;  // Key press of the queued direction
+static Uint64       inputTime;         // Key press of the last direction applied by a tick
+static Uint64       inputTickTime;
+static FILE *       pReplayFile;
+static ArchiveWriter * pArchiveWriter;
+static Replay       replay;
+
+// Internal variables for the tick timing statistics
+// Deviation of each tick interval from the tick period
+static Uint64       lastTickTime;
+static BOOL         hasLastTick;
+static uint         statCount;
+static double       statSumMs;
+static double       statMaxMs;
+
+// Internal functions
+
+// Return TRUE if the snake should be moving
+static inline BOOL IsTicking(void)
+{
+    return isActive && !isPaused
+        && lastResult != cTickDefeat && lastResult != cTickVictory;
+}
+
+// Return the earlier of two timeouts in milliseconds, -1 meaning none
+static inline int EarlierTimeout(const int l, const int r)
+{
+    return (l < 0 || (r >= 0 && r < l)) ? r : l;
+}
+
+// Log an event for the current game
+static inline void Emit(const EventType type, const uint value)
+{
+    EventLogEmit(type, gameId, SimulationGetTickCount(), value);
+}
+
+// Queue a command
+// Return FALSE if the queue is full
+static BOOL Post(const SimCommandType type, const uint value, const Uint64 time)
+{
+    const uint HEAD = (uint)SDL_AtomicGet(&queueHead);
+    if(HEAD - (uint)SDL_AtomicGet(&queueTail) == QUEUE_SIZE)
+    {
+        return FALSE;
+    }
+    commandArr[HEAD & (QUEUE_SIZE - 1)].type  = type;
+    commandArr[HEAD & (QUEUE_SIZE - 1)].value = value;
+    commandArr[HEAD & (QUEUE_SIZE - 1)].time  = time;
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&queueHead, (int)(HEAD + 1));
+    if(pWakeSemaphore)
+    {
+        SDL_SemPost(pWakeSemaphore);
+    }
+    return TRUE;
+}
+
+// Copy the current state into the back slot and make it the fresh one
+static void Publish(void)
+{
+    SnapshotCapture(&snapshotArr[backSlot], gameId, lastResult);
+    snapshotArr[backSlot].moveTime   = moveTime;
+    snapshotArr[backSlot].tickPeriod = tickPeriod;
+    snapshotArr[backSlot].vacated    = vacatedPoint;
+    snapshotArr[backSlot].inputTime     = inputTime;
+    snapshotArr[backSlot].inputTickTime = inputTickTime;
+    SpectatorPublish(&snapshotArr[backSlot]);
+    SDL_MemoryBarrierRelease();
+    backSlot = SDL_AtomicSet(&sharedSlot, backSlot | SLOT_FRESH) & ~SLOT_FRESH;
+}
+
+// Start a new game with the given seed
+// A game that cannot be reset for lack of memory starts as a defeat
+static void Reset(const uint seed)
+{
+    const BOOL IS_RESET = SimulationReset(boardWidth, boardHeight, seed);
+    ReplayRecordBegin(&replay, seed);
+    gameId++;
+    lastResult  = IS_RESET ? cTickMoved : cTickDefeat;
+    isActive    = FALSE;
+    isPaused    = FALSE;
+    hasLastTick = FALSE;
+    moveTime    = 0;
+    inputTime   = 0;
+    deadline    = SDL_GetPerformanceCounter() + tickPeriod;
+    pendingInputTime = 0;
+    Emit(cEventGameStart, seed);
+}
+
+// Apply all commands posted since the last call
+// Return TRUE if the state has changed outside of a tick
+static BOOL ProcessCommands(void)
+{
+    BOOL hasChanged = FALSE;
+    const uint HEAD = (uint)SDL_AtomicGet(&queueHead);
+    SDL_MemoryBarrierAcquire();
+
+    uint tail = (uint)SDL_AtomicGet(&queueTail);
+    for(; tail != HEAD; tail++)
+    {
+        const SimCommand COMMAND = commandArr[tail & (QUEUE_SIZE - 1)];
+        switch(COMMAND.type)
+        {
+            case cCommandReset:
+                Reset(COMMAND.value);
+                hasChanged = TRUE;
+                break;
+
+            case cCommandSpeed:
+                tickPeriod = SDL_GetPerformanceFrequency() / ((COMMAND.value > 0) ? COMMAND.value : 1);
+                Emit(cEventSpeed, COMMAND.value);
+                break;
+
+            case cCommandDirection:
+                SnakeSetDirection((Direction)COMMAND.value);
+                pendingInputTime = COMMAND.time;
+                isActive = TRUE;
+                Emit(cEventDirection, COMMAND.value);
+                break;
+
+            case cCommandPause:
+                isPaused    = TRUE;
+                hasLastTick = FALSE;
+                Emit(cEventPause, 0);
+                break;
+
+            case cCommandResume:
+                isPaused = FALSE;
+                Emit(cEventResume, 0);
+                break;
+
+            case cCommandGrow:
+                hasChanged = SnakeAddBodyPart() || hasChanged;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    // The slots must be read before the producer can reuse them
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&queueTail, (int)tail);
+    return hasChanged;
+}
+
+// Move the snake and record the input
+// The time of the move and the cell the tail left are kept for drawing,
+// and the time of the key press the tick applied for the latency statistics
+// Finished games are appended to the replay file or archive
+static void Tick(const Uint64 now)
+{
+    ALLOC_SCOPE_BEGIN(cAllocScopeTick);
+    if(hasLastTick)
+    {
+        const double FREQUENCY = (double)SDL_GetPerformanceFrequency();
+        double deviation = ((double)(now - lastTickTime) - (double)tickPeriod) * 1000.0 / FREQUENCY;
+        deviation = (deviation < 0.0) ? -deviation : deviation;
+        statSumMs += deviation;
+        statMaxMs = (deviation > statMaxMs) ? deviation : statMaxMs;
+        statCount++;
+    }
+    lastTickTime = now;
+    hasLastTick  = TRUE;
+    if(pendingInputTime != 0)
+    {
+        inputTime        = pendingInputTime;
+        inputTickTime    = now;
+        pendingInputTime = 0;
+    }
+
+    ReplayRecordTick(&replay, SnakeGetQueuedDirection());
+    const Point OLD_TAIL = BoardToPoint(SnakeGetTail()->index);
+    lastResult = SimulationTick();
+    moveTime = 0;
+    if(lastResult == cTickMoved || lastResult == cTickAte || lastResult == cTickVictory)
+    {
+        const Point TAIL = BoardToPoint(SnakeGetTail()->index);
+        moveTime     = now;
+        vacatedPoint = PointsAreEqual(TAIL, OLD_TAIL) ? (Point){-1, -1} : OLD_TAIL;
+    }
+    switch(lastResult)
+    {
+        case cTickAte:
+        case cTickMoved:
+        {
+            const Point HEAD = BoardToPoint(SnakeGetHead()->index);
+            Emit(cEventMove, (uint)HEAD.x | ((uint)HEAD.y << 16));
+            if(lastResult == cTickAte)
+            {
+                Emit(cEventEat, SimulationGetScore());
+            }
+            break;
+        }
+
+        case cTickDefeat:
+            Emit(cEventDefeat, SimulationGetScore());
+            break;
+
+        case cTickVictory:
+            Emit(cEventVictory, SimulationGetScore());
+            break;
+
+        default:
+            break;
+    }
+    if((pReplayFile || pArchiveWriter) && (lastResult == cTickDefeat || lastResult == cTickVictory))
+    {
+        ReplayRecordEnd(&replay, lastResult);
+        if(pReplayFile)
+        {
+            ReplayWrite(pReplayFile, &replay);
+            fflush(pReplayFile);
+        }
+        if(pArchiveWriter && ArchiveWriterAppend(pArchiveWriter, &replay))
+        {
+            fflush(pArchiveWriter->pFile);
+        }
+    }
+    ALLOC_SCOPE_END(cAllocScopeTick, FALSE);
+}
+
+// Thread function
+// Sleep until the next tick is due or a command arrives
+static int SimThreadMain(void * pData)
+{
+    (void)pData;
+    while(!SDL_AtomicGet(&isQuitting))
+    {
+        const int TIMEOUT = SimThreadUpdate();
+        if(TIMEOUT < 0)
+        {
+            SDL_SemWait(pWakeSemaphore);
+        }
+        else if(TIMEOUT > 0)
+        {
+            SDL_SemWaitTimeout(pWakeSemaphore, (Uint32)TIMEOUT);
+        }
+        // Less than a millisecond left, keep checking until the deadline
+    }
+    return 0;
+}
+
+// Public functions
+
+// "Constructor"
+// Allocate the snapshots for a board of the given size
+// Return FALSE if the snapshots cannot be allocated
+BOOL SimThreadInitialise(const ushort width, const ushort height)
+{
+    boardWidth  = width;
+    boardHeight = height;
+    tickPeriod  = SDL_GetPerformanceFrequency();
+    for(int i = 0; i < 3; i++)
+    {
+        if(!SnapshotInitialise(&snapshotArr[i], width, height))
+        {
+            return FALSE;
+        }
+    }
+    backSlot  = 0;
+    frontSlot = 2;
+    SDL_AtomicSet(&sharedSlot, 1);
+    SDL_AtomicSet(&queueHead, 0);
+    SDL_AtomicSet(&queueTail, 0);
+    return TRUE;
+}
+
+// "Destructor"
+// Stop the thread and free the simulation
+void SimThreadFree(void)
+{
+    if(pThread)
+    {
+        SDL_AtomicSet(&isQuitting, 1);
+        SDL_SemPost(pWakeSemaphore);
+        SDL_WaitThread(pThread, NULL);
+        pThread = NULL;
+    }
+    if(pWakeSemaphore)
+    {
+        SDL_DestroySemaphore(pWakeSemaphore);
+        pWakeSemaphore = NULL;
+    }
+    SimulationFree();
+    ReplayFree(&replay);
+    for(int i = 0; i < 3; i++)
+    {
+        SnapshotFree(&snapshotArr[i]);
+    }
+    pReplayFile    = NULL;
+    pArchiveWriter = NULL;
+}
+
+// Start the simulation thread
+// Without a thread, SimThreadUpdate() must be called by the game loop
+// Return FALSE if the thread cannot be created
+BOOL SimThreadStart(const BOOL isThreaded)
+{
+    if(!isThreaded)
+    {
+        return TRUE;
+    }
+    SDL_AtomicSet(&isQuitting, 0);
+    pWakeSemaphore = SDL_CreateSemaphore(0);
+    if(pWakeSemaphore)
+    {
+        pThread = SDL_CreateThread(SimThreadMain, "simulation", NULL);
+    }
+    if(!pThread && pWakeSemaphore)
+    {
+        SDL_DestroySemaphore(pWakeSemaphore);
+        pWakeSemaphore = NULL;
+    }
+    return pThread != NULL;
+}
+
+// Apply queued commands and move the snake if a tick is due
+// A snapshot is published whenever the state has changed
+// Return the milliseconds until the next tick, -1 if the snake is not moving
+// While spectating is on, also wake up in time to accept new spectators
+int SimThreadUpdate(void)
+{
+    const int SPECTATOR_TIMEOUT = SpectatorUpdate();
+    BOOL hasChanged = ProcessCommands();
+    if(!IsTicking())
+    {
+        if(hasChanged)
+        {
+            Publish();
+        }
+        return SPECTATOR_TIMEOUT;
+    }
+
+    const Uint64 NOW = SDL_GetPerformanceCounter();
+    if(NOW >= deadline)
+    {
+        // The schedule starts with the first tick after the snake is
+        // started or resumed, and restarts if a whole tick was missed
+        if(!hasLastTick || NOW - deadline >= tickPeriod)
+        {
+            deadline = NOW;
+        }
+        Tick(NOW);
+        deadline += tickPeriod;
+        hasChanged = TRUE;
+    }
+    if(hasChanged)
+    {
+        Publish();
+    }
+    if(!IsTicking())
+    {
+        return SPECTATOR_TIMEOUT;
+    }
+    return EarlierTimeout((int)(((deadline - NOW) * 1000) / SDL_GetPerformanceFrequency()), SPECTATOR_TIMEOUT);
+}
+
+// Queue a command for the simulation
+// Return FALSE if the queue is full
+BOOL SimThreadPost(const SimCommandType type, const uint value)
+{
+    return Post(type, value, 0);
+}
+
+// Queue a direction from a key pressed at 'pressTime' (performance counter)
+// The snapshot of the tick that applies it carries the press time
+// and the tick time, see Snapshot::inputTime
+// Return FALSE if the queue is full
+BOOL SimThreadPostInput(const uint direction, const unsigned long long pressTime)
+{
+    return Post(cCommandDirection, direction, pressTime);
+}
+
+// Return the most recently published snapshot
+// The snapshot stays unchanged until the next call
+const Snapshot * SimThreadGetSnapshot(void)
+{
+    if(SDL_AtomicGet(&sharedSlot) & SLOT_FRESH)
+    {
+        frontSlot = SDL_AtomicSet(&sharedSlot, frontSlot) & ~SLOT_FRESH;
+        SDL_MemoryBarrierAcquire();
+    }
+    return &snapshotArr[frontSlot];
+}
+
+// Append every finished game to the file
+// Must be set before SimThreadStart()
+void SimThreadRecordReplays(FILE * pFile)
+{
+    pReplayFile = pFile;
+}
+
+// Append every finished game to the archive
+// The index is only written when the archive is closed, after SimThreadFree()
+// Must be set before SimThreadStart()
+void SimThreadRecordArchive(ArchiveWriter * pWriter)
+{
+    pArchiveWriter = pWriter;
+}
+
+// Return how far tick intervals strayed from the tick period
+void SimThreadGetTickStats(uint * pCount, double * pAverageMs, double * pMaxMs)
+{
+    *pCount     = statCount;
+    *pAverageMs = (statCount > 0) ? statSumMs / statCount : 0.0;
+    *pMaxMs     = statMaxMs;
+}
@@ -0,0 +1,41 @@
+#ifndef SIMTHREAD_H
+#define SIMTHREAD_H
+
+#include <stdio.h>
+
+#include "types.h"
+#include "snapshot.h"
+#include "archive.h"
+
+// Simulation runner
+//
+// All simulation calls (resets, ticks, replay recording) are made here.
+// The game posts commands into a lock-free queue, and every simulation
+// state is published as a Snapshot through a lock-free triple buffer.
+// When threaded, the runner has its own thread and ticks on exact deadlines;
+// otherwise SimThreadUpdate() is called from the game loop
+typedef enum
+{
+    cCommandReset     = 0,  // value: seed
+    cCommandSpeed     = 1,  // value: updates per second
+    cCommandDirection = 2,  // value: Direction, starts the snake
+    cCommandPause     = 3,
+    cCommandResume    = 4,
+    cCommandGrow      = 5,  // Debug only
+} SimCommandType;
+
+// Main functions
+BOOL SimThreadInitialise(const ushort width, const ushort height);
+void SimThreadFree(void);
+BOOL SimThreadStart(const BOOL isThreaded);
+int SimThreadUpdate(void);
+
+// Helper functions
+BOOL SimThreadPost(const SimCommandType type, const uint value);
+BOOL SimThreadPostInput(const uint direction, const unsigned long long pressTime);
+const Snapshot * SimThreadGetSnapshot(void);
+void SimThreadRecordReplays(FILE * pFile);
+void SimThreadRecordArchive(ArchiveWriter * pWriter);
+void SimThreadGetTickStats(uint * pCount, double * pAverageMs, double * pMaxMs);
+
+#endif // !SIMTHREAD_H
@@ -0,0 +1,223 @@
+#include "simulation.h"
+
+#include <stdlib.h>
+
+#include "board.h"
+#include "globals.h"
+#include "snake.h"
+
+// Inspired by the old Nokia snake
+// In order to be slightly less annoying, the game will
+// essentially pause itself for specified number of frames
+// if the player is about to lose
+// This "warning" time is quite significant on lower speeds (+ 1 second)
+// but on higher speeds it might be pretty insignificant
+static const uchar WARNING_FRAMES_ALLOWANCE = 1;
+
+// Internal variables
+ENGINE_STATE uint  score;
+ENGINE_STATE uint  tickCount;
+ENGINE_STATE uchar warningFrames;
+ENGINE_STATE BOOL  hasSnakeEaten;
+ENGINE_STATE BOOL  isWrapping;
+
+// Internal functions
+
+// Return the safe-move mask of one game
+// Mirrors the collision check in SimulationTick() without branches:
+// a move is safe if the cell is free or food, or if it is the tail.
+// The tail counts as vacated even on the tick after eating, when it
+// stays where it is, because that is what SimulationTick() does
+static inline uchar GetSafeMoves(const SafeMoveQuery * pQuery)
+{
+    const uint VALID_MASK = (1u << cTypeFree) | (1u << cTypeFood);
+    const uint OFFSET_ARR[4] = { -pQuery->rowCells, pQuery->rowCells, (uint)-1, 1 };
+    uint mask = 0;
+    for(uint bit = 0; bit < 4; bit++)
+    {
+        // Cells off the board are in the wall border, unless the board wraps
+        const uint STEP = pQuery->headIndex + OFFSET_ARR[bit];
+        const uint NEXT = (pQuery->pWrapArr) ? pQuery->pWrapArr[STEP] : STEP;
+        const uint CELL = BoardReadCellFrom(pQuery->pCells, NEXT);
+        const uint IS_SAFE = (VALID_MASK >> CELL) | (NEXT == pQuery->tailIndex);
+        mask |= (IS_SAFE & 1) << bit;
+    }
+
+    // Turning back is ignored (see SnakeUpdateDirection()), so the reverse
+    // direction is as safe as going straight. Opposite directions share
+    // all but the lowest bit of their bit number
+    const uint STRAIGHT_SHIFT = pQuery->direction - (pQuery->direction > cDirectionDown);
+    const uint REVERSE_SHIFT = STRAIGHT_SHIFT ^ 1;
+    const uint IS_STRAIGHT_SAFE = (mask >> STRAIGHT_SHIFT) & 1;
+    return (uchar)((mask & ~(1u << REVERSE_SHIFT)) | (IS_STRAIGHT_SAFE << REVERSE_SHIFT));
+}
+
+// Public functions
+
+// Reset board and snake to the initial state
+// The seed fully determines where food will be placed,
+// so the same seed and inputs always replay the same game
+// Return FALSE if the board or the snake could not be allocated
+BOOL SimulationReset(const ushort width, const ushort height, const uint seed)
+{
+    // The board keeps its arrays when the size does not change,
+    // and the snake reuses its nodes
+    if(!BoardInitialise(width, height, isWrapping))
+    {
+        return FALSE;
+    }
+    BoardSetSeed(seed);
+
+    const Point INITIAL_POINT = { width / 2, height / 2 };
+    if(!SnakeInitialise(BoardToIndex(INITIAL_POINT), SNAKE_INIT_LENGTH))
+    {
+        return FALSE;
+    }
+
+    SnakePart * pCurrent = NULL;
+    for(pCurrent = SnakeGetHead(); pCurrent; pCurrent = pCurrent->pNext)
+    {
+        BoardSetCellAt(pCurrent->index, cTypeSnake);
+    }
+    BoardGenerateFood();
+
+    score         = 0;
+    tickCount     = 0;
+    warningFrames = 0;
+    hasSnakeEaten = FALSE;
+    return TRUE;
+}
+
+// "Destructor"
+void SimulationFree(void)
+{
+    BoardFree();
+    SnakeFree();
+}
+
+// Advance the snake by one cell
+// Apply the queued direction, handle collisions, food and victory
+TickResult SimulationTick(void)
+{
+    tickCount++;
+
+    const BOOL HAS_DIRECTION_CHANGED = SnakeUpdateDirection();
+    const uint NEXT_HEAD_INDEX = SnakeGetNextHeadIndex();
+
+    // Check if snake is about to lose, but ignore if next head position is
+    // tail, as the tail will move out of the way
+    if(!BoardIsCellValidAt(NEXT_HEAD_INDEX) && NEXT_HEAD_INDEX != SnakeGetTail()->index)
+    {
+        // If we haven't changed the snake's direction and still have
+        // warning frame allowance, use that and return
+        if(!HAS_DIRECTION_CHANGED && warningFrames++ < WARNING_FRAMES_ALLOWANCE)
+        {
+            return cTickWarning;
+        }
+
+        // Snake lost
+        // We're not updating the position to make it look better
+        return cTickDefeat;
+    }
+    warningFrames = 0; // Reset warning frames
+
+    // If snake has just eaten, the board state and snake might be out of sync
+    // causing the food to spawn on the snake's tail
+    // Only update the tail if snake has NOT eaten
+    if(!hasSnakeEaten)
+    {
+        BoardSetCellAt(SnakeGetTail()->index, cTypeFree);
+    }
+    else
+    {
+        hasSnakeEaten = FALSE;
+    }
+
+    // Update the snake's position and maybe handle food
+    SnakeMove();
+    const uint HEAD_INDEX = SnakeGetHead()->index;
+
+    if(BoardGetCellAt(HEAD_INDEX) == cTypeFood)
+    {
+        // A snake that cannot grow ends the game
+        if(!SnakeAddBodyPart())
+        {
+            BoardSetCellAt(HEAD_INDEX, cTypeSnake);
+            return cTickDefeat;
+        }
+        score += 5;
+        hasSnakeEaten = TRUE;
+    }
+    BoardSetCellAt(HEAD_INDEX, cTypeSnake);
+    if(hasSnakeEaten && !BoardGenerateFood())
+    {
+        return cTickVictory;
+    }
+    return hasSnakeEaten ? cTickAte : cTickMoved;
+}
+
+// Return the current score
+uint SimulationGetScore(void)
+{
+    return score;
+}
+
+// Return the number of ticks since the last reset
+uint SimulationGetTickCount(void)
+{
+    return tickCount;
+}
+
+// Select whether the snake leaves the board on one edge and comes back on
+// the opposite one instead of hitting a wall. Takes effect on the next reset
+void SimulationSetWrapping(const BOOL isEnabled)
+{
+    isWrapping = isEnabled;
+}
+
+// Return TRUE if games started by the next reset wrap around the edges
+BOOL SimulationIsWrapping(void)
+{
+    return isWrapping;
+}
+
+// Return the mask bit (SIMULATION_MOVE_*) of a direction
+uchar SimulationMoveBit(const uint direction)
+{
+    // Directions are 0, 1, 3 and 4, the bits 0 to 3
+    return (uchar)(1u << (direction - (direction > cDirectionDown)));
+}
+
+// Return the safe-move mask of the current game
+// A direction's bit is set if setting that direction before the next tick
+// moves the snake without a collision. Unsafe moves that keep the
+// direction may still be saved by the warning frame
+uchar SimulationGetSafeMoves(void)
+{
+    SafeMoveQuery query;
+    SimulationGetSafeMoveQuery(&query);
+    return (query.pCells) ? GetSafeMoves(&query) : 0;
+}
+
+// Describe the current game for SimulationGetSafeMovesBatch()
+// The query points at the live board, so it is only valid until the next tick
+void SimulationGetSafeMoveQuery(SafeMoveQuery * pQuery)
+{
+    const SnakePart * pHead = SnakeGetHead();
+    pQuery->pCells    = (pHead) ? BoardGetCells() : NULL;
+    pQuery->pWrapArr  = BoardGetWrapTable();
+    pQuery->rowCells  = BoardGetRowCells();
+    pQuery->cellCount = BoardGetCellCount();
+    pQuery->headIndex = (pHead) ? pHead->index : BOARD_NO_INDEX;
+    pQuery->tailIndex = (pHead) ? SnakeGetTail()->index : BOARD_NO_INDEX;
+    pQuery->direction = SnakeGetDirection();
+}
+
+// Write the safe-move mask of every query
+void SimulationGetSafeMovesBatch(const SafeMoveQuery * pQueryArr, uchar * pMaskArr, const uint count)
+{
+    for(uint i = 0; i < count; i++)
+    {
+        pMaskArr[i] = GetSafeMoves(&pQueryArr[i]);
+    }
+}
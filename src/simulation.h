@@ -0,0 +1,53 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "types.h"
+
+// Outcome of a single snake update
+typedef enum
+{
+    cTickMoved   = 0,
+    cTickAte     = 1,
+    cTickWarning = 2,
+    cTickDefeat  = 3,
+    cTickVictory = 4,
+} TickResult;
+
+// Safe-move mask bits, one per direction
+// The bit of the reverse direction is the bit of going straight,
+// as the snake ignores a request to turn back on itself
+#define SIMULATION_MOVE_UP    0x1
+#define SIMULATION_MOVE_DOWN  0x2
+#define SIMULATION_MOVE_LEFT  0x4
+#define SIMULATION_MOVE_RIGHT 0x8
+
+// Everything the safe-move query needs to know about one game
+typedef struct
+{
+    const uchar * pCells;     // Cells in board storage format, see BoardGetCells()
+    const uint *  pWrapArr;   // See BoardGetWrapTable(), NULL if the board has walls at its edges
+    uint          rowCells;   // See BoardGetRowCells()
+    uint          cellCount;  // See BoardGetCellCount()
+    uint          headIndex;
+    uint          tailIndex;
+    uint          direction;  // Direction applied on the last tick
+} SafeMoveQuery;
+
+// Main functions
+BOOL SimulationReset(const ushort width, const ushort height, const uint seed);
+void SimulationFree(void);
+TickResult SimulationTick(void);
+
+// Helper functions
+uint SimulationGetScore(void);
+uint SimulationGetTickCount(void);
+void SimulationSetWrapping(const BOOL isEnabled);
+BOOL SimulationIsWrapping(void);
+
+// Safe-move functions
+uchar SimulationGetSafeMoves(void);
+void SimulationGetSafeMoveQuery(SafeMoveQuery * pQuery);
+void SimulationGetSafeMovesBatch(const SafeMoveQuery * pQueryArr, uchar * pMaskArr, const uint count);
+uchar SimulationMoveBit(const uint direction);
+
+#endif // !SIMULATION_H
@@ -1,29 +1,104 @@
 #include "snake.h"
 
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
 #include "globals.h"
+#include "trace.h"
+#ifndef HEADLESS
+#include "camera.h"
 #include "renderer.h"
+#include "snakecache.h"
+#include "snakegrid.h"
+#include "snakemesh.h"
+#include "snakering.h"
+#endif // !HEADLESS
 
 // Internal variables
-static Direction directions[2];
+ENGINE_STATE Direction directions[2];
+ENGINE_STATE int offsetArr[cDirectionRight + 1];
+ENGINE_STATE const uint * pWrapArr;  // See BoardGetWrapTable()
+
+#ifndef HEADLESS
+// Colours are only used for drawing, they are
+// calculated on the first SnakeDraw() call
 static RGB colourArr[SNAKE_COLOUR_COUNT];
+static BOOL hasColours;
+static SnakeRenderer snakeRenderer;
+static BOOL isInterpolating;
+#endif // !HEADLESS
 
-static SnakePart * pHead;
-static SnakePart * pTail;
+ENGINE_STATE SnakePart * pHead;
+ENGINE_STATE SnakePart * pTail;
+ENGINE_STATE uint length;
+
+// Nodes are allocated in blocks and recycled through a free list,
+// so moving the snake never allocates and growing it rarely does.
+// The blocks are kept across games until SnakeFree()
+#define PART_BLOCK_SIZE 256
+
+typedef struct PartBlock
+{
+    struct PartBlock * pNext;
+    SnakePart partArr[PART_BLOCK_SIZE];
+} PartBlock;
+
+ENGINE_STATE PartBlock * pBlockList;
+ENGINE_STATE SnakePart * pFreePart;
 
 // Internal linked-list functions
 
+// Take a node from the free list, allocating a new block if it is empty
+// Return NULL if out of memory
+static SnakePart * SnakePartCreate(const uint index)
+{
+    if(!pFreePart)
+    {
+        PartBlock * pBlock = (PartBlock *)malloc(sizeof(PartBlock));
+        if(!pBlock)
+        {
+            return NULL;
+        }
+        pBlock->pNext = pBlockList;
+        pBlockList = pBlock;
+        for(uint i = 0; i < PART_BLOCK_SIZE; i++)
+        {
+            pBlock->partArr[i].pNext = (i + 1 < PART_BLOCK_SIZE) ? &pBlock->partArr[i + 1] : NULL;
+        }
+        pFreePart = &pBlock->partArr[0];
+    }
+    SnakePart * pPart = pFreePart;
+    pFreePart = pPart->pNext;
+    pPart->index = index;
+    pPart->pPrev = NULL;
+    pPart->pNext = NULL;
+    return pPart;
+}
+
+// Return a node to the free list
+static inline void SnakePartRecycle(SnakePart * pPart)
+{
+    pPart->pNext = pFreePart;
+    pFreePart = pPart;
+}
+
 // Return TRUE if head pointer is NULL
 static inline BOOL SnakePartIsEmpty(void)
 {
     return !pHead;
 }
 
-// Create a new node, with the specified point
+// Create a new node, with the specified cell index
 // and add to the front of the linked-list
-static void SnakePartPushHead(const Point point)
+// Return FALSE if out of memory
+static BOOL SnakePartPushHead(const uint index)
 {
-    SnakePart * pNewHead = (SnakePart *)calloc(1, sizeof(SnakePart));
-    pNewHead->point = point;
+    SnakePart * pNewHead = SnakePartCreate(index);
+    if(!pNewHead)
+    {
+        return FALSE;
+    }
 
     if(SnakePartIsEmpty())
     {
@@ -35,14 +110,20 @@ static void SnakePartPushHead(const Point point)
     }
     pNewHead->pNext = pHead;
     pHead = pNewHead;
+    length++;
+    return TRUE;
 }
 
-// Create a new node, with the specified point
+// Create a new node, with the specified cell index
 // and add to the back of the linked-list
-static void SnakePartPushTail(const Point point)
+// Return FALSE if out of memory
+static BOOL SnakePartPushTail(const uint index)
 {
-    SnakePart * pNewTail = (SnakePart *)calloc(1, sizeof(SnakePart));
-    pNewTail->point = point;
+    SnakePart * pNewTail = SnakePartCreate(index);
+    if(!pNewTail)
+    {
+        return FALSE;
+    }
 
     if(SnakePartIsEmpty())
     {
@@ -54,13 +135,15 @@ static void SnakePartPushTail(const Point point)
         pNewTail->pPrev = pTail;
     }
     pTail = pNewTail;
+    length++;
+    return TRUE;
 }
 
 // Remove the head node from the linked-list and
 // set the next node as the head.
 // Return the pointer to old head
 //
-// NOTE: Pointer must be freed
+// NOTE: Pointer must be recycled
 static SnakePart * SnakePartPopHead(void)
 {
     SnakePart * pCurrentHead = pHead;
@@ -73,6 +156,7 @@ static SnakePart * SnakePartPopHead(void)
         pTail = NULL;
     }
     pHead = pHead->pNext;
+    length--;
     return pCurrentHead;
 }
 
@@ -80,7 +164,7 @@ static SnakePart * SnakePartPopHead(void)
 // set the previous node as the tail.
 // Return the pointer to old tail
 //
-// NOTE: Pointer must be freed
+// NOTE: Pointer must be recycled
 static SnakePart * SnakePartPopTail(void)
 {
     SnakePart * pCurrentTail = pTail;
@@ -93,22 +177,26 @@ static SnakePart * SnakePartPopTail(void)
         pHead = NULL;
     }
     pTail = pTail->pPrev;
+    length--;
     return pCurrentTail;
 }
 
-// Delete and free all nodes from the linked-list
-static void SnakePartFree(void)
+// Recycle all nodes of the linked-list
+static void SnakePartClear(void)
 {
     SnakePart * pCurrent = NULL;
     for(pCurrent = pHead; pCurrent;)
     {
         SnakePart * pTemp = pCurrent;
         pCurrent = pCurrent->pNext;
-        free(pTemp);
-        pTemp = NULL;
+        SnakePartRecycle(pTemp);
     }
+    pHead = NULL;
+    pTail = NULL;
+    length = 0;
 }
 
+#ifndef HEADLESS
 // Calculate the rainbow colours and
 // populate the colour array
 static void SetColours(void)
@@ -165,57 +253,80 @@ static void SetColours(void)
         colourArr[i] = rgb;
     }
 }
+#endif // !HEADLESS
 
 // Public functions
 
 // "Constructor"
 // Set all variables to initial values
-void SnakeInitialise(Point initialPoint, const ushort initialLength)
+// The board must be initialised first, as the
+// direction offsets depend on its row length and wrapping
+// The nodes of a previous snake are reused
+// Return FALSE if out of memory
+BOOL SnakeInitialise(uint initialIndex, const ushort initialLength)
 {
-    // Reset colour and direction queue arrays
-    memset(colourArr, 0, sizeof(colourArr));
+    // Reset direction queue array
     directions[0] = cDirectionRight;
     directions[1] = cDirectionRight;
 
-    // Linked-list nodes
-    pHead = NULL;
-    pTail = NULL;
+    // Index offset of one step in each direction
+    const int ROW_CELLS = (int)BoardGetRowCells();
+    offsetArr[cDirectionUp]    = -ROW_CELLS;
+    offsetArr[cDirectionDown]  = ROW_CELLS;
+    offsetArr[cDirectionLeft]  = -1;
+    offsetArr[cDirectionRight] = 1;
+    pWrapArr = BoardGetWrapTable();
 
-    // Populate the colour array
-    SetColours();
+    // Linked-list nodes
+    SnakePartClear();
 
     // Add the initial snake parts
-    SnakePartPushHead(initialPoint);
+    if(!SnakePartPushHead(initialIndex))
+    {
+        return FALSE;
+    }
     for(ushort i = 1; i < initialLength; i++)
     {
-        initialPoint.x--;
-        SnakePartPushTail(initialPoint);
+        initialIndex += offsetArr[cDirectionLeft];
+        if(!SnakePartPushTail(initialIndex))
+        {
+            return FALSE;
+        }
     }
+    return TRUE;
 }
 
 // "Destructor"
-// Destroy the linked-list
+// Destroy the linked-list and free the node blocks
 void SnakeFree(void)
 {
-    SnakePartFree();
-    pHead = NULL;
-    pTail = NULL;
+    SnakePartClear();
+    while(pBlockList)
+    {
+        PartBlock * pNext = pBlockList->pNext;
+        free(pBlockList);
+        pBlockList = pNext;
+    }
+    pFreePart = NULL;
+    pWrapArr = NULL;
 }
 
 // Update snake's direction enum and position
 void SnakeMove(void)
 {
+    TRACE_BEGIN(SnakeMove);
     SnakeUpdateDirection();
 
     // No point updating the whole snake.
     // Remove the tail and add a new head node.
+    // The old tail is reused as the new head, so this never allocates
     SnakePart * pOldTail = SnakePartPopTail();
     if(pOldTail)
     {
-        free(pOldTail);
-        pOldTail = NULL;
+        SnakePartRecycle(pOldTail);
     }
-    SnakePartPushHead(SnakeGetNextHeadPoint());
+    (void)SnakePartPushHead(SnakeGetNextHeadIndex());
+    TRACE_END(SnakeMove);
 }
 
 // Set the snake's secondary direction enum
@@ -229,96 +340,272 @@ void SnakeSetDirection(const Direction newDirection)
 }
 
 // Push new tail node to the linked-list
-// The new cell will have the same point as current tail
+// The new cell will have the same index as current tail
 // Increment snake length
-void SnakeAddBodyPart(void)
+// Return FALSE if out of memory
+BOOL SnakeAddBodyPart(void)
 {
-    SnakePartPushTail(pTail->point);
+    return SnakePartPushTail(pTail->index);
 }
 
-// Draw the snake
-void SnakeDraw(void)
+#ifndef HEADLESS
+// Fill one part of the snake with rectangles
+// 'cell' is the size of a cell and (offsetX, offsetY) the window
+// position of cell (0, 0), see camera.h
+static void DrawPart(const Snapshot * pSnapshot, const uint part, const int cell, const int offsetX, const int offsetY)
 {
-    SDL_Renderer * pRenderer = GetRenderer();
-    int windowWidth = 0;
-    int windowHeight = 0;
-    RendererGetWindowSize(&windowWidth, &windowHeight);
+    const Point * pBodyArr = pSnapshot->pBodyArr;
+    const uint LENGTH = pSnapshot->length;
+    const int OFFSET_X = offsetX;
+    const int OFFSET_Y = offsetY;
+
+    // Set the correct rainbow colour
+    #define MAKE_RGB(rgb) rgb.r, rgb.g, rgb.b
+    RendererSetColour(MAKE_RGB(colourArr[part % SNAKE_COLOUR_COUNT]), SDL_ALPHA_OPAQUE);
+    #undef MAKE_RGB
+
+    // Draw this bit when the snake is longer than 1 cell
+    // We have to calculate some rectangles for snake turns and stuff
+    const BOOL HAS_NEXT = (part + 1 < LENGTH);
+    const BOOL HAS_PREV = (part > 0);
+    if(HAS_NEXT || HAS_PREV)
+    {
+        // Evil macro function:
+        // Find the difference between points a and b
+        // The rectangle should have length 4/5 of the cell centred on the cell
+        // If the the difference is positive (i.e. going towards the top-left corner)
+        // shift the rectangle by 1/5 cell size towards the origin.
+        // Across the edge of a wrapping board the rectangle reaches
+        // the edge, see SnapshotStepBetween()
+        #define DRAW_CELL(a, b)\
+            do\
+            {\
+                const short PADDING = (cell / 5);\
+                Point diff;\
+                diff.x = SnapshotStepBetween(a.x, b.x);\
+                diff.y = SnapshotStepBetween(a.y, b.y);\
+                \
+                SDL_Rect r;\
+                r.x = (a.x * cell) + PADDING;\
+                r.y = (a.y * cell) + PADDING;\
+                r.w = PADDING * 4;\
+                r.h = PADDING * 3;\
+                \
+                if(diff.x != 0)\
+                {\
+                    r.x = (diff.x == 1) ? r.x - PADDING : r.x;\
+                    r.x += OFFSET_X;\
+                    r.y += OFFSET_Y;\
+                    RendererFillRect(&r);\
+                }\
+                else if(diff.y != 0)\
+                {\
+                    r.w = PADDING * 3;\
+                    r.h = PADDING * 4;\
+                    r.y = (diff.y == 1) ? r.y - PADDING : r.y;\
+                    r.x += OFFSET_X;\
+                    r.y += OFFSET_Y;\
+                    RendererFillRect(&r);\
+                }\
+            }while(0)
+
+        // For each cell, we draw up to two overlapping rectangles so that
+        // we can get either a rectangle with one side = cellsize
+        // or an "L" shape where the snake is turning, connecting the next and previous cell
+        // This is probably not the most efficient method for drawing since we could
+        // draw a single polygon or even a cached shape, but it works so don't touch it
+        if(HAS_NEXT) { DRAW_CELL(pBodyArr[part], pBodyArr[part + 1]); }
+        if(HAS_PREV) { DRAW_CELL(pBodyArr[part], pBodyArr[part - 1]); }
+        #undef DRAW_CELL
+    }
+    else // Snake is 1 cell big. Draw a simple square
+    {
+        SDL_Rect r;
+        r.x = OFFSET_X + (pBodyArr[part].x * cell) + (cell / 5);
+        r.y = OFFSET_Y + (pBodyArr[part].y * cell) + (cell / 5);
+        r.w = (cell / 5) * 3;
+        r.h = (cell / 5) * 3;
+        RendererFillRect(&r);
+    }
+}
 
-    const int OFFSET_X = (windowWidth / 2) - ((BOARD_WIDTH * CELL_SIZE) / 2);
-    const int OFFSET_Y = (windowHeight / 2) - ((BOARD_HEIGHT * CELL_SIZE) / 2);
-    ushort i = 0;
+// Fill the parts of the snake in view with rectangles
+// When the camera shows only part of the board, the parts are looked up
+// in the spatial index, so the parts out of view are never visited
+static void DrawRects(const Snapshot * pSnapshot)
+{
+    int offsetX = 0;
+    int offsetY = 0;
+    int minX = 0;
+    int minY = 0;
+    int maxX = 0;
+    int maxY = 0;
+    CameraGetOffset(&offsetX, &offsetY);
+    CameraGetVisibleCells(&minX, &minY, &maxX, &maxY);
+    const int CELL = CameraGetCellSize();
+
+    const uint * pPartArr = NULL;
+    uint count = 0;
+    if(!CameraIsFixed() && SnakeGridFind(pSnapshot, minX, minY, maxX, maxY, &pPartArr, &count))
+    {
+        for(uint i = 0; i < count; i++)
+        {
+            DrawPart(pSnapshot, pPartArr[i], CELL, offsetX, offsetY);
+        }
+        return;
+    }
+    for(uint part = 0; part < pSnapshot->length; part++)
+    {
+        DrawPart(pSnapshot, part, CELL, offsetX, offsetY);
+    }
+}
 
-    for(SnakePart * pCurrent = pHead; pCurrent; pCurrent = pCurrent->pNext)
+// Return the colour of the part at position i, as the active renderer draws it
+// Anchored colours stay with the tick a part was laid (see snakering.h),
+// the other renderers colour a part by its distance from the head
+static RGB GetPartColour(const Snapshot * pSnapshot, const uint i)
+{
+    if(snakeRenderer == cSnakeRendererCached && CameraIsFixed())
     {
-        // Set the correct rainbow colour
-        #define MAKE_RGB(rgb) rgb.r, rgb.g, rgb.b
-        SDL_SetRenderDrawColor(pRenderer, MAKE_RGB(colourArr[i]), SDL_ALPHA_OPAQUE);
-        #undef MAKE_RGB
+        return colourArr[(SNAKE_COLOUR_COUNT - SnakeRingSlot(pSnapshot->tickCount, i)) % SNAKE_COLOUR_COUNT];
+    }
+    return colourArr[i % SNAKE_COLOUR_COUNT];
+}
 
-        i = (i + 1) % SNAKE_COLOUR_COUNT;
+// Fill the body rectangle of a cell that reaches the edge shared with the
+// neighbour one step (stepX, stepY) away, 'length' pixels into the cell
+static void FillPartTowards(const Point cell, const int stepX, const int stepY, const int length,
+                            const int cellSize, const int offsetX, const int offsetY)
+{
+    const short PADDING = (cellSize / 5);
+    SDL_Rect r;
+    r.x = offsetX + (cell.x * cellSize) + PADDING;
+    r.y = offsetY + (cell.y * cellSize) + PADDING;
+    r.w = PADDING * 3;
+    r.h = PADDING * 3;
+    if(stepX != 0)
+    {
+        r.x = (stepX > 0) ? offsetX + ((cell.x + 1) * cellSize) - length : offsetX + (cell.x * cellSize);
+        r.w = length;
+    }
+    else
+    {
+        r.y = (stepY > 0) ? offsetY + ((cell.y + 1) * cellSize) - length : offsetY + (cell.y * cellSize);
+        r.h = length;
+    }
+    RendererFillRect(&r);
+}
 
-        // Draw this bit when the snake is longer than 1 cell
-        // We have to calculate some rectangles for snake turns and stuff
-        if(pCurrent->pNext || pCurrent->pPrev)
-        {
-            // Evil macro function:
-            // Find the difference between points a and b
-            // The rectangle should have length 4/5 of the cell centred on the cell
-            // If the the difference is positive (i.e. going towards the top-left corner)
-            // shift the rectangle by 1/5 cell size towards the origin
-            #define DRAW_CELL(a, b)\
-                do\
-                {\
-                    const short PADDING = (CELL_SIZE / 5);\
-                    Point diff = a;\
-                    diff.x -= b.x;\
-                    diff.y -= b.y;\
-                    \
-                    SDL_Rect r;\
-                    r.x = (a.x * CELL_SIZE) + PADDING;\
-                    r.y = (a.y * CELL_SIZE) + PADDING;\
-                    r.w = PADDING * 4;\
-                    r.h = PADDING * 3;\
-                    \
-                    if(diff.x != 0)\
-                    {\
-                        r.x = (diff.x == 1) ? r.x - PADDING : r.x;\
-                        r.x += OFFSET_X;\
-                        r.y += OFFSET_Y;\
-                        SDL_RenderFillRect(pRenderer, &r);\
-                    }\
-                    else if(diff.y != 0)\
-                    {\
-                        r.w = PADDING * 3;\
-                        r.h = PADDING * 4;\
-                        r.y = (diff.y == 1) ? r.y - PADDING : r.y;\
-                        r.x += OFFSET_X;\
-                        r.y += OFFSET_Y;\
-                        SDL_RenderFillRect(pRenderer, &r);\
-                    }\
-                }while(0)
-
-            // For each cell, we draw up to two overlapping rectangles so that
-            // we can get either a rectangle with one side = cellsize
-            // or an "L" shape where the snake is turning, connecting the next and previous cell
-            // This is probably not the most efficient method for drawing since we could
-            // draw a single polygon or even a cached shape, but it works so don't touch it
-            if(pCurrent->pNext) { DRAW_CELL(pCurrent->point, pCurrent->pNext->point); }
-            if(pCurrent->pPrev) { DRAW_CELL(pCurrent->point, pCurrent->pPrev->point); }
-            #undef DRAW_CELL
-        }
-        else // Snake is 1 cell big. Draw a simple square
-        {
-            SDL_Rect r;
-            r.x = OFFSET_X + (pCurrent->point.x * CELL_SIZE) + (CELL_SIZE / 5);
-            r.y = OFFSET_Y + (pCurrent->point.y * CELL_SIZE) + (CELL_SIZE / 5);
-            r.w = (CELL_SIZE / 5) * 3;
-            r.h = (CELL_SIZE / 5) * 3;
-            SDL_RenderFillRect(pRenderer, &r);
-        }
+// Draw the snake part of the way between its last two ticks
+// Whatever renderer drew the snake, only the two ends move: the head
+// is cut back towards the previous head, and the cell the tail left is
+// filled towards the new tail. The simulation itself stays on the grid
+static void DrawMotion(const Snapshot * pSnapshot)
+{
+    const uint LENGTH = pSnapshot->length;
+    if(LENGTH < 2 || pSnapshot->moveTime == 0 || pSnapshot->tickPeriod == 0)
+    {
+        return;
+    }
+    const unsigned long long NOW = SDL_GetPerformanceCounter();
+    const double ELAPSED = (double)(NOW - pSnapshot->moveTime) / (double)pSnapshot->tickPeriod;
+    if(NOW < pSnapshot->moveTime || ELAPSED >= 1.0)
+    {
+        return;
+    }
+
+    int offsetX = 0;
+    int offsetY = 0;
+    CameraGetOffset(&offsetX, &offsetY);
+    const int OFFSET_X = offsetX;
+    const int OFFSET_Y = offsetY;
+    const int CELL = CameraGetCellSize();
+    const int FULL_LENGTH = (CELL / 5) * 4;
+    const int HEAD_LENGTH = (int)(FULL_LENGTH * ELAPSED);
+    const Point * pBodyArr = pSnapshot->pBodyArr;
+
+    // Clear the head, then grow it from the edge it entered through
+    const Point HEAD = pBodyArr[0];
+    const int HEAD_STEP_X = SnapshotStepBetween(pBodyArr[1].x, HEAD.x);
+    const int HEAD_STEP_Y = SnapshotStepBetween(pBodyArr[1].y, HEAD.y);
+    RendererSetColour(0, 0, 0, SDL_ALPHA_OPAQUE);
+    FillPartTowards(HEAD, HEAD_STEP_X, HEAD_STEP_Y, FULL_LENGTH, CELL, OFFSET_X, OFFSET_Y);
+    if(HEAD_LENGTH > 0)
+    {
+        const RGB COLOUR = GetPartColour(pSnapshot, 0);
+        RendererSetColour(COLOUR.r, COLOUR.g, COLOUR.b, SDL_ALPHA_OPAQUE);
+        FillPartTowards(HEAD, HEAD_STEP_X, HEAD_STEP_Y, HEAD_LENGTH, CELL, OFFSET_X, OFFSET_Y);
+    }
+
+    // The tail shrinks out of the cell it left, towards the edge it left through
+    const Point VACATED = pSnapshot->vacated;
+    const int TAIL_LENGTH = FULL_LENGTH - HEAD_LENGTH;
+    if(VACATED.x >= 0 && TAIL_LENGTH > 0)
+    {
+        const Point TAIL = pBodyArr[LENGTH - 1];
+        const RGB COLOUR = GetPartColour(pSnapshot, LENGTH);
+        RendererSetColour(COLOUR.r, COLOUR.g, COLOUR.b, SDL_ALPHA_OPAQUE);
+        FillPartTowards(VACATED, SnapshotStepBetween(TAIL.x, VACATED.x), SnapshotStepBetween(TAIL.y, VACATED.y),
+                        TAIL_LENGTH, CELL, OFFSET_X, OFFSET_Y);
     }
 }
 
+// Draw the snake from a snapshot
+// With interpolation on, the ends are then moved to where they
+// would be between the snapshot's tick and the next one
+void SnakeDraw(const Snapshot * pSnapshot)
+{
+    TRACE_BEGIN(SnakeDraw);
+    if(!hasColours)
+    {
+        SetColours();
+        hasColours = TRUE;
+    }
+    // The cached and mesh renderers can only draw the whole board at CELL_SIZE
+    const BOOL IS_FIXED = CameraIsFixed();
+    BOOL isDrawn = FALSE;
+    if(IS_FIXED && (snakeRenderer == cSnakeRendererMesh || snakeRenderer == cSnakeRendererSmooth))
+    {
+        isDrawn = SnakeMeshDraw(pSnapshot, colourArr, snakeRenderer == cSnakeRendererSmooth);
+    }
+    else if(IS_FIXED && snakeRenderer != cSnakeRendererRects)
+    {
+        isDrawn = SnakeCacheDraw(pSnapshot, colourArr, snakeRenderer == cSnakeRendererFlowing);
+    }
+    if(!isDrawn)
+    {
+        DrawRects(pSnapshot);
+    }
+    if(isInterpolating)
+    {
+        DrawMotion(pSnapshot);
+    }
+    TRACE_END(SnakeDraw);
+}
+
+// Select how the snake is drawn
+// The other renderers fall back to rectangles if they cannot draw,
+// the mesh on the software backend for example
+void SnakeSetRenderer(const SnakeRenderer renderer)
+{
+    snakeRenderer = renderer;
+}
+
+// Select whether the head and tail move smoothly between ticks
+// instead of jumping a whole cell on every tick
+void SnakeSetInterpolation(const BOOL isEnabled)
+{
+    isInterpolating = isEnabled;
+}
+
+#endif // !HEADLESS
+
+// Return the number of body parts
+uint SnakeGetLength(void)
+{
+    return length;
+}
+
 // Return the pointer to the head node
 SnakePart * SnakeGetHead(void)
 {
@@ -331,6 +618,18 @@ SnakePart * SnakeGetTail(void)
     return pTail;
 }
 
+// Return the direction applied on the last update
+Direction SnakeGetDirection(void)
+{
+    return directions[0];
+}
+
+// Return the direction that will be applied on the next update
+Direction SnakeGetQueuedDirection(void)
+{
+    return directions[1];
+}
+
 // Update snake's direction from the internal queue
 // Return TRUE if direction has been updated
 BOOL SnakeUpdateDirection(void)
@@ -343,35 +642,15 @@ BOOL SnakeUpdateDirection(void)
     return FALSE;
 }
 
-// Return snake's next head position
-Point SnakeGetNextHeadPoint(void)
+// Return snake's next head cell index
+// Moving off the board gives an index that is not a valid cell,
+// or the cell on the opposite edge if the board wraps
+uint SnakeGetNextHeadIndex(void)
 {
     if(!pHead)
     {
-        const Point EMPTY = {-1, -1};
-        return EMPTY;
-    }
-    Point nextPoint = pHead->point;
-    switch(directions[0])
-    {
-        case cDirectionUp:
-            nextPoint.y--;
-            break;
-
-        case cDirectionDown:
-            nextPoint.y++;
-            break;
-
-        case cDirectionLeft:
-            nextPoint.x--;
-            break;
-
-        case cDirectionRight:
-            nextPoint.x++;
-            break;
-
-        default:
-            break;
+        return BOARD_NO_INDEX;
     }
-    return nextPoint;
+    const uint NEXT = pHead->index + (uint)offsetArr[directions[0]];
+    return (pWrapArr) ? pWrapArr[NEXT] : NEXT;
 }
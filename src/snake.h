@@ -2,6 +2,7 @@
 #define SNAKE_H
 
 #include "types.h"
+#include "snapshot.h"
 
 // Direction enum
 // Value '2' is skipped to prevent snake from travelling
@@ -15,27 +16,44 @@ typedef enum
 } Direction;
 
 // Snake node as a doubly linked-list
+// Cells are stored as board indices (see BoardToPoint())
 struct SnakePart
 {
-    Point point;
+    uint index;
     struct SnakePart * pPrev;
     struct SnakePart * pNext;
 };
 typedef struct SnakePart SnakePart;
 
+// Ways of drawing the snake
+// Rectangles are filled every frame, the others follow the body incrementally
+// (see snakecache.h for flowing and cached, snakemesh.h for mesh and smooth)
+typedef enum
+{
+    cSnakeRendererRects   = 0,
+    cSnakeRendererFlowing = 1,
+    cSnakeRendererCached  = 2,
+    cSnakeRendererMesh    = 3,
+    cSnakeRendererSmooth  = 4,
+} SnakeRenderer;
+
 // Main functions
-void SnakeInitialise(Point initialPoint, const ushort initialLength);
+BOOL SnakeInitialise(uint initialIndex, const ushort initialLength);
 void SnakeFree(void);
 void SnakeMove(void);
 void SnakeSetDirection(const Direction newDirection);
-void SnakeAddBodyPart(void);
-void SnakeDraw(void);
+BOOL SnakeAddBodyPart(void);
+void SnakeDraw(const Snapshot * pSnapshot);
+void SnakeSetRenderer(const SnakeRenderer renderer);
+void SnakeSetInterpolation(const BOOL isEnabled);
 
 // Helper functions
-ushort SnakeGetLength(void);
+uint SnakeGetLength(void);
 SnakePart * SnakeGetHead(void);
 SnakePart * SnakeGetTail(void);
+Direction SnakeGetDirection(void);
+Direction SnakeGetQueuedDirection(void);
 BOOL SnakeUpdateDirection(void);
-Point SnakeGetNextHeadPoint(void);
+uint SnakeGetNextHeadIndex(void);
 
 #endif // !SNAKE_H
@@ -0,0 +1,352 @@
+#include "snakecache.h"
+
+#include <string.h>
+
+#include "globals.h"
+#include "renderer.h"
+#include "framebuffer.h"
+#include "snakering.h"
+
+// Index 0 is transparent, colour slot s is drawn with index s + 1
+#define TRANSPARENT_INDEX 0
+
+// Internal variables for the cached body
+static SnakeRing     ring;
+
+// Internal variables for the image
+// The accelerated backend uploads changed pixels to a streaming texture,
+// the software backend blits the surface straight into the framebuffer
+static SDL_Surface * pSurface;
+static SDL_Texture * pTexture;
+static ushort        boardWidth;
+static ushort        boardHeight;
+static uint          cachedGameId;
+static uint          cachedTick;
+static BOOL          isCached;
+
+// Internal variables for the palette, ARGB8888
+static Uint32        paletteArr[SNAKE_COLOUR_COUNT + 1];
+static uint          paletteOffset;
+static BOOL          hasPalette;
+
+// Internal variables for the changed area, in cells
+// Nothing has changed while dirtyMinX > dirtyMaxX
+static int           dirtyMinX;
+static int           dirtyMinY;
+static int           dirtyMaxX;
+static int           dirtyMaxY;
+
+// Internal functions
+
+static inline void MarkDirty(const Point point)
+{
+    dirtyMinX = (point.x < dirtyMinX) ? point.x : dirtyMinX;
+    dirtyMinY = (point.y < dirtyMinY) ? point.y : dirtyMinY;
+    dirtyMaxX = (point.x > dirtyMaxX) ? point.x : dirtyMaxX;
+    dirtyMaxY = (point.y > dirtyMaxY) ? point.y : dirtyMaxY;
+}
+
+static inline void MarkAllDirty(void)
+{
+    dirtyMinX = 0;
+    dirtyMinY = 0;
+    dirtyMaxX = boardWidth - 1;
+    dirtyMaxY = boardHeight - 1;
+}
+
+static inline void ClearDirty(void)
+{
+    dirtyMinX = boardWidth;
+    dirtyMinY = boardHeight;
+    dirtyMaxX = -1;
+    dirtyMaxY = -1;
+}
+
+// Make a cell transparent
+static void ClearCell(const Point point)
+{
+    SDL_Rect r;
+    r.x = point.x * CELL_SIZE;
+    r.y = point.y * CELL_SIZE;
+    r.w = CELL_SIZE;
+    r.h = CELL_SIZE;
+    SDL_FillRect(pSurface, &r, TRANSPARENT_INDEX);
+    MarkDirty(point);
+}
+
+// Draw the connection from cell a towards its neighbour b
+// Same shapes as the rectangles renderer: 4/5 of the cell,
+// reaching the edge of the cell on the neighbour's side
+static void DrawConnector(const Point a, const Point b, const uchar slot)
+{
+    const short PADDING = (CELL_SIZE / 5);
+    const int DIFF_X = SnapshotStepBetween(a.x, b.x);
+    const int DIFF_Y = SnapshotStepBetween(a.y, b.y);
+
+    SDL_Rect r;
+    r.x = (a.x * CELL_SIZE) + PADDING;
+    r.y = (a.y * CELL_SIZE) + PADDING;
+    if(DIFF_X != 0)
+    {
+        r.w = PADDING * 4;
+        r.h = PADDING * 3;
+        r.x = (DIFF_X == 1) ? r.x - PADDING : r.x;
+    }
+    else if(DIFF_Y != 0)
+    {
+        r.w = PADDING * 3;
+        r.h = PADDING * 4;
+        r.y = (DIFF_Y == 1) ? r.y - PADDING : r.y;
+    }
+    else
+    {
+        return;
+    }
+    SDL_FillRect(pSurface, &r, slot + 1);
+}
+
+// Draw the shapes of the part at position i, without clearing its cell
+static void DrawPart(const Snapshot * pSnapshot, const uint i)
+{
+    const Point * pBodyArr = pSnapshot->pBodyArr;
+    const uchar SLOT = SnakeRingAt(&ring, i)->slot;
+    if(pSnapshot->length == 1)
+    {
+        // Snake is 1 cell big. Draw a simple square
+        SDL_Rect r;
+        r.x = (pBodyArr[i].x * CELL_SIZE) + (CELL_SIZE / 5);
+        r.y = (pBodyArr[i].y * CELL_SIZE) + (CELL_SIZE / 5);
+        r.w = (CELL_SIZE / 5) * 3;
+        r.h = (CELL_SIZE / 5) * 3;
+        SDL_FillRect(pSurface, &r, SLOT + 1);
+    }
+    if(i + 1 < pSnapshot->length)
+    {
+        DrawConnector(pBodyArr[i], pBodyArr[i + 1], SLOT);
+    }
+    if(i > 0)
+    {
+        DrawConnector(pBodyArr[i], pBodyArr[i - 1], SLOT);
+    }
+    MarkDirty(pBodyArr[i]);
+}
+
+// Redraw the tail cell
+// Parts added by growing share the tail's cell, so all of them are drawn
+static void RedrawTail(const Snapshot * pSnapshot)
+{
+    const uint LAST = pSnapshot->length - 1;
+    ClearCell(pSnapshot->pBodyArr[LAST]);
+    for(uint i = SnakeRingTailStart(pSnapshot); i <= LAST; i++)
+    {
+        DrawPart(pSnapshot, i);
+    }
+}
+
+// Redraw the whole snake, used after a reset or when the cache is out of step
+static void Rebuild(const Snapshot * pSnapshot)
+{
+    SDL_FillRect(pSurface, NULL, TRANSPARENT_INDEX);
+    SnakeRingAssign(&ring, pSnapshot);
+    for(uint i = 0; i < pSnapshot->length; i++)
+    {
+        DrawPart(pSnapshot, i);
+    }
+    MarkAllDirty();
+}
+
+// Bring the cached body in line with the snapshot
+// Only the parts that changed since the last snapshot are drawn
+static void Update(const Snapshot * pSnapshot)
+{
+    const uint LENGTH = pSnapshot->length;
+    const uint TICKS = pSnapshot->tickCount - cachedTick;
+    if(!isCached || pSnapshot->gameId != cachedGameId || pSnapshot->tickCount < cachedTick
+    || !SnakeRingCanFollow(&ring, pSnapshot, TICKS))
+    {
+        Rebuild(pSnapshot);
+        return;
+    }
+    const uint MOVES = SnakeRingCountMoves(&ring, pSnapshot, TICKS);
+    if(MOVES > TICKS)
+    {
+        Rebuild(pSnapshot);
+        return;
+    }
+    if(MOVES == 0 && LENGTH == ring.count)
+    {
+        return;
+    }
+
+    SnakeRingPushHeads(&ring, pSnapshot, MOVES);
+    while(SnakeRingHasStaleTail(&ring, pSnapshot, MOVES))
+    {
+        ClearCell(SnakeRingPopTail(&ring));
+    }
+    SnakeRingPushGrownTail(&ring, pSnapshot);
+    if(!SnakeRingMatches(&ring, pSnapshot))
+    {
+        Rebuild(pSnapshot);
+        return;
+    }
+
+    // The new heads and the joint of the old head, then the tail,
+    // which may have lost its connection or share a cell with new parts
+    for(uint i = 0; i <= MOVES && i < LENGTH; i++)
+    {
+        ClearCell(pSnapshot->pBodyArr[i]);
+        DrawPart(pSnapshot, i);
+    }
+    RedrawTail(pSnapshot);
+}
+
+// Allocate the body ring and image for a board
+// Return FALSE if out of memory
+static BOOL Allocate(const ushort width, const ushort height)
+{
+    SnakeCacheFree();
+    boardWidth  = width;
+    boardHeight = height;
+    pSurface    = SDL_CreateRGBSurfaceWithFormat(0, width * CELL_SIZE, height * CELL_SIZE, 8, SDL_PIXELFORMAT_INDEX8);
+    if(!SnakeRingInitialise(&ring, width, height) || !pSurface)
+    {
+        return FALSE;
+    }
+    SDL_SetColorKey(pSurface, SDL_TRUE, TRANSPARENT_INDEX);
+
+    if(RendererGetBackend() == cBackendAccelerated)
+    {
+        pTexture = SDL_CreateTexture(GetRenderer(), SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                                     width * CELL_SIZE, height * CELL_SIZE);
+        if(!pTexture)
+        {
+            return FALSE;
+        }
+        SDL_SetTextureBlendMode(pTexture, SDL_BLENDMODE_BLEND);
+    }
+    return TRUE;
+}
+
+// Rotate the palette so that slot s shows colour (offset - s)
+static void SetPalette(const RGB * pColourArr, const uint offset)
+{
+    SDL_Color colourArr[SNAKE_COLOUR_COUNT + 1];
+    memset(colourArr, 0, sizeof(colourArr));
+    paletteArr[TRANSPARENT_INDEX] = 0;
+    for(uint slot = 0; slot < SNAKE_COLOUR_COUNT; slot++)
+    {
+        const RGB COLOUR = pColourArr[(offset + SNAKE_COLOUR_COUNT - slot) % SNAKE_COLOUR_COUNT];
+        colourArr[slot + 1].r = COLOUR.r;
+        colourArr[slot + 1].g = COLOUR.g;
+        colourArr[slot + 1].b = COLOUR.b;
+        colourArr[slot + 1].a = SDL_ALPHA_OPAQUE;
+        paletteArr[slot + 1] = FramebufferMakeColour(COLOUR.r, COLOUR.g, COLOUR.b, SDL_ALPHA_OPAQUE);
+    }
+    SDL_SetPaletteColors(pSurface->format->palette, colourArr, 0, SNAKE_COLOUR_COUNT + 1);
+    paletteOffset = offset;
+    hasPalette    = TRUE;
+}
+
+// Convert the changed pixels into the texture
+static void Upload(void)
+{
+    if(dirtyMinX > dirtyMaxX)
+    {
+        return;
+    }
+    SDL_Rect r;
+    r.x = dirtyMinX * CELL_SIZE;
+    r.y = dirtyMinY * CELL_SIZE;
+    r.w = (dirtyMaxX - dirtyMinX + 1) * CELL_SIZE;
+    r.h = (dirtyMaxY - dirtyMinY + 1) * CELL_SIZE;
+
+    void * pPixels = NULL;
+    int pitch = 0;
+    if(SDL_LockTexture(pTexture, &r, &pPixels, &pitch) != 0)
+    {
+        return;
+    }
+    for(int y = 0; y < r.h; y++)
+    {
+        const Uint8 * pSrc = (const Uint8 *)pSurface->pixels + ((r.y + y) * pSurface->pitch) + r.x;
+        Uint32 * pDst = (Uint32 *)((Uint8 *)pPixels + (y * pitch));
+        for(int x = 0; x < r.w; x++)
+        {
+            pDst[x] = paletteArr[pSrc[x]];
+        }
+    }
+    SDL_UnlockTexture(pTexture);
+}
+
+// Public functions
+
+// Draw the snake from a snapshot using the cached body
+// Return FALSE if the cache cannot be created, nothing is drawn then
+BOOL SnakeCacheDraw(const Snapshot * pSnapshot, const RGB * pColourArr, const BOOL isFlowing)
+{
+    if(!pSurface || pSnapshot->width != boardWidth || pSnapshot->height != boardHeight)
+    {
+        if(!Allocate(pSnapshot->width, pSnapshot->height))
+        {
+            SnakeCacheFree();
+            return FALSE;
+        }
+    }
+    if(pSnapshot->length == 0)
+    {
+        return TRUE;
+    }
+
+    Update(pSnapshot);
+    cachedGameId = pSnapshot->gameId;
+    cachedTick   = pSnapshot->tickCount;
+    isCached     = TRUE;
+
+    // A flowing palette changes colour of every part on each tick
+    const uint OFFSET = isFlowing ? pSnapshot->tickCount % SNAKE_COLOUR_COUNT : 0;
+    if(!hasPalette || OFFSET != paletteOffset)
+    {
+        SetPalette(pColourArr, OFFSET);
+        MarkAllDirty();
+    }
+
+    int windowWidth = 0;
+    int windowHeight = 0;
+    RendererGetWindowSize(&windowWidth, &windowHeight);
+
+    SDL_Rect r;
+    r.w = boardWidth * CELL_SIZE;
+    r.h = boardHeight * CELL_SIZE;
+    r.x = (windowWidth / 2) - (r.w / 2);
+    r.y = (windowHeight / 2) - (r.h / 2);
+    if(pTexture)
+    {
+        Upload();
+        SDL_RenderCopy(GetRenderer(), pTexture, NULL, &r);
+    }
+    else
+    {
+        FramebufferBlitSurface(pSurface, &r);
+    }
+    ClearDirty();
+    return TRUE;
+}
+
+// Free the cache
+// Must be called before the renderer is freed
+void SnakeCacheFree(void)
+{
+    if(pTexture)
+    {
+        SDL_DestroyTexture(pTexture);
+        pTexture = NULL;
+    }
+    if(pSurface)
+    {
+        SDL_FreeSurface(pSurface);
+        pSurface = NULL;
+    }
+    SnakeRingFree(&ring);
+    isCached   = FALSE;
+    hasPalette = FALSE;
+}
@@ -0,0 +1,25 @@
+#ifndef SNAKECACHE_H
+#define SNAKECACHE_H
+
+#include "types.h"
+#include "snapshot.h"
+
+// Cached snake rendering
+//
+// The snake is kept in an 8-bit image of the board, holding a palette index
+// per pixel. Every part gets its colour slot when it enters the body, from
+// the tick at which it is (or would have been) the head. A new snapshot only
+// redraws what changed since the last one: the new head cells, the joint of
+// the old head, the erased tail cells and the new tail. That is O(1) per tick
+// regardless of the snake's length.
+//
+// The palette turns colour slots into rainbow colours. Rotated by the tick
+// count, every part gets the colour of its distance from the head, exactly
+// like the rectangles renderer ("flowing"). A fixed palette keeps each
+// cell's colour from the tick it was laid ("anchored")
+
+// Main functions
+BOOL SnakeCacheDraw(const Snapshot * pSnapshot, const RGB * pColourArr, const BOOL isFlowing);
+void SnakeCacheFree(void);
+
+#endif // !SNAKECACHE_H
@@ -0,0 +1,239 @@
+#include "snakegrid.h"
+
+#include <stdlib.h>
+
+#include "snakering.h"
+
+// Ring position that never holds a part, ends a bucket's list
+#define NO_PART ((uint)-1)
+
+// Internal variables for the indexed body
+static SnakeRing ring;
+static ushort    boardWidth;
+static ushort    boardHeight;
+static uint      indexedGameId;
+static uint      indexedTick;
+static BOOL      isIndexed;
+
+// Internal variables for the buckets
+// Every bucket holds a doubly linked list of ring positions,
+// the links are stored per ring position
+static uint *    pBucketArr;   // First ring position in every bucket
+static uint *    pNextArr;
+static uint *    pPrevArr;
+static uint      bucketColumns;
+static uint      bucketRows;
+
+// Parts found by the last SnakeGridFind(), as positions from the head
+static uint *    pFoundArr;
+
+// Internal functions
+
+// Return the bucket holding a board cell
+static inline uint BucketOf(const Point point)
+{
+    return (((uint)point.y / SNAKE_GRID_BUCKET) * bucketColumns) + ((uint)point.x / SNAKE_GRID_BUCKET);
+}
+
+// Return the ring position of the part at position i from the head
+static inline uint RingPosition(const uint i)
+{
+    return (ring.headPos + i) % ring.capacity;
+}
+
+// Add the part at a ring position to the list of its bucket
+static void Link(const uint pos)
+{
+    const uint BUCKET = BucketOf(ring.pPartArr[pos].point);
+    pNextArr[pos] = pBucketArr[BUCKET];
+    pPrevArr[pos] = NO_PART;
+    if(pBucketArr[BUCKET] != NO_PART)
+    {
+        pPrevArr[pBucketArr[BUCKET]] = pos;
+    }
+    pBucketArr[BUCKET] = pos;
+}
+
+// Remove the part at a ring position from the list of its bucket
+// The part must still hold its cell
+static void Unlink(const uint pos)
+{
+    if(pPrevArr[pos] != NO_PART)
+    {
+        pNextArr[pPrevArr[pos]] = pNextArr[pos];
+    }
+    else
+    {
+        pBucketArr[BucketOf(ring.pPartArr[pos].point)] = pNextArr[pos];
+    }
+    if(pNextArr[pos] != NO_PART)
+    {
+        pPrevArr[pNextArr[pos]] = pPrevArr[pos];
+    }
+}
+
+// Index the whole body of a snapshot
+static void Rebuild(const Snapshot * pSnapshot)
+{
+    for(uint bucket = 0; bucket < bucketColumns * bucketRows; bucket++)
+    {
+        pBucketArr[bucket] = NO_PART;
+    }
+    SnakeRingAssign(&ring, pSnapshot);
+    for(uint i = 0; i < ring.count; i++)
+    {
+        Link(RingPosition(i));
+    }
+}
+
+// Bring the index up to date with a snapshot, see SnakeCacheDraw()
+// Only the new heads, the stale tail parts and the grown tail are moved
+static void Update(const Snapshot * pSnapshot)
+{
+    const uint LENGTH = pSnapshot->length;
+    const uint TICKS = pSnapshot->tickCount - indexedTick;
+    if(!isIndexed || ring.count == 0 || pSnapshot->gameId != indexedGameId || pSnapshot->tickCount < indexedTick
+    || !SnakeRingCanFollow(&ring, pSnapshot, TICKS))
+    {
+        Rebuild(pSnapshot);
+        return;
+    }
+    const uint MOVES = SnakeRingCountMoves(&ring, pSnapshot, TICKS);
+    if(MOVES > TICKS)
+    {
+        Rebuild(pSnapshot);
+        return;
+    }
+    if(MOVES == 0 && LENGTH == ring.count)
+    {
+        return;
+    }
+
+    // As SnakeRingPushHeads() and SnakeRingPushGrownTail(), linking every part
+    for(uint i = MOVES; i > 0; i--)
+    {
+        SnakeRingPushHead(&ring, pSnapshot->pBodyArr[i - 1], SnakeRingSlot(pSnapshot->tickCount, i - 1));
+        Link(ring.headPos);
+    }
+    while(SnakeRingHasStaleTail(&ring, pSnapshot, MOVES))
+    {
+        Unlink(RingPosition(ring.count - 1));
+        SnakeRingPopTail(&ring);
+    }
+    while(ring.count < LENGTH)
+    {
+        SnakeRingPushTail(&ring, pSnapshot->pBodyArr[ring.count], SnakeRingSlot(pSnapshot->tickCount, ring.count));
+        Link(RingPosition(ring.count - 1));
+    }
+    if(!SnakeRingMatches(&ring, pSnapshot))
+    {
+        Rebuild(pSnapshot);
+    }
+}
+
+// Allocate the body ring and the buckets for a board
+// Return FALSE if out of memory
+static BOOL Allocate(const ushort width, const ushort height)
+{
+    SnakeGridFree();
+    boardWidth    = width;
+    boardHeight   = height;
+    bucketColumns = (width + SNAKE_GRID_BUCKET - 1) / SNAKE_GRID_BUCKET;
+    bucketRows    = (height + SNAKE_GRID_BUCKET - 1) / SNAKE_GRID_BUCKET;
+    if(!SnakeRingInitialise(&ring, width, height))
+    {
+        return FALSE;
+    }
+    pBucketArr = (uint *)malloc(bucketColumns * bucketRows * sizeof(uint));
+    pNextArr   = (uint *)malloc(ring.capacity * sizeof(uint));
+    pPrevArr   = (uint *)malloc(ring.capacity * sizeof(uint));
+    pFoundArr  = (uint *)malloc(ring.capacity * sizeof(uint));
+    return (pBucketArr && pNextArr && pPrevArr && pFoundArr);
+}
+
+// Public functions
+
+// "Constructor"
+// Allocate the index for a board, so that drawing does not allocate
+// SnakeGridFind() allocates it again if the board size changes
+// Return FALSE if out of memory
+BOOL SnakeGridInitialise(const ushort width, const ushort height)
+{
+    if(!Allocate(width, height))
+    {
+        SnakeGridFree();
+        return FALSE;
+    }
+    return TRUE;
+}
+
+// Find the parts of a snapshot's snake in the buckets over the
+// cells [minX, maxX] by [minY, maxY], which may include some parts
+// just outside the range
+// The parts are returned as positions from the head, in no
+// particular order, and stay valid until the next call
+// Return FALSE if out of memory
+BOOL SnakeGridFind(const Snapshot * pSnapshot, const int minX, const int minY, const int maxX, const int maxY,
+                   const uint ** ppPartArr, uint * pCount)
+{
+    if(!pBucketArr || pSnapshot->width != boardWidth || pSnapshot->height != boardHeight)
+    {
+        if(!Allocate(pSnapshot->width, pSnapshot->height))
+        {
+            SnakeGridFree();
+            return FALSE;
+        }
+    }
+    *ppPartArr = pFoundArr;
+    *pCount    = 0;
+    if(pSnapshot->length == 0)
+    {
+        return TRUE;
+    }
+
+    Update(pSnapshot);
+    indexedGameId = pSnapshot->gameId;
+    indexedTick   = pSnapshot->tickCount;
+    isIndexed     = TRUE;
+
+    // Buckets over the part of the range on the board
+    const int FIRST_X = (minX > 0) ? minX : 0;
+    const int FIRST_Y = (minY > 0) ? minY : 0;
+    const int LAST_X  = (maxX < boardWidth) ? maxX : boardWidth - 1;
+    const int LAST_Y  = (maxY < boardHeight) ? maxY : boardHeight - 1;
+    if(FIRST_X > LAST_X || FIRST_Y > LAST_Y)
+    {
+        return TRUE;
+    }
+
+    uint count = 0;
+    for(uint row = (uint)FIRST_Y / SNAKE_GRID_BUCKET; row <= (uint)LAST_Y / SNAKE_GRID_BUCKET; row++)
+    {
+        for(uint column = (uint)FIRST_X / SNAKE_GRID_BUCKET; column <= (uint)LAST_X / SNAKE_GRID_BUCKET; column++)
+        {
+            for(uint pos = pBucketArr[(row * bucketColumns) + column]; pos != NO_PART; pos = pNextArr[pos])
+            {
+                pFoundArr[count++] = (pos + ring.capacity - ring.headPos) % ring.capacity;
+            }
+        }
+    }
+    *pCount = count;
+    return TRUE;
+}
+
+// "Destructor"
+void SnakeGridFree(void)
+{
+    SnakeRingFree(&ring);
+    free(pBucketArr);
+    free(pNextArr);
+    free(pPrevArr);
+    free(pFoundArr);
+    pBucketArr  = NULL;
+    pNextArr    = NULL;
+    pPrevArr    = NULL;
+    pFoundArr   = NULL;
+    boardWidth  = 0;
+    boardHeight = 0;
+    isIndexed   = FALSE;
+}
@@ -0,0 +1,24 @@
+#ifndef SNAKEGRID_H
+#define SNAKEGRID_H
+
+#include "types.h"
+#include "snapshot.h"
+
+// Spatial index of the snake's body
+//
+// The board is split into square buckets of SNAKE_GRID_BUCKET cells, and
+// every part of the body is kept in the list of the bucket its cell is in.
+// The body follows the snapshots in a SnakeRing (see snakering.h), so a new
+// snapshot only moves the parts that changed: O(1) per tick regardless of
+// the snake's length. The parts in a range of cells are then found by
+// walking the buckets over that range, without looking at the rest of the
+// body, which is how the rectangles renderer skips the parts out of view
+#define SNAKE_GRID_BUCKET 8
+
+// Main functions
+BOOL SnakeGridInitialise(const ushort width, const ushort height);
+BOOL SnakeGridFind(const Snapshot * pSnapshot, const int minX, const int minY, const int maxX, const int maxY,
+                   const uint ** ppPartArr, uint * pCount);
+void SnakeGridFree(void);
+
+#endif // !SNAKEGRID_H
@@ -0,0 +1,339 @@
+#include "snakemesh.h"
+
+#include <stdlib.h>
+
+#include "globals.h"
+#include "renderer.h"
+#include "framebuffer.h"
+#include "snakering.h"
+
+// Vertices and indices of one part: a quad towards the next part,
+// then a quad towards the previous part
+#define PART_VERTICES 8
+#define PART_INDICES  12
+
+// Colour slot s is texel s + 1. The texels at both ends repeat
+// slots 149 and 0, so smooth colours also blend where the gradient wraps
+#define GRADIENT_WIDTH (SNAKE_COLOUR_COUNT + 2)
+
+// Internal variables for the mesh
+// Part k of the ring owns the vertices from k * PART_VERTICES, the
+// indices never change and only the live part of the ring is drawn
+static SnakeRing     ring;
+static SDL_Vertex *  pVertexArr;
+static int *         pIndexArr;
+static ushort        boardWidth;
+static ushort        boardHeight;
+static int           offsetX;
+static int           offsetY;
+static uint          cachedGameId;
+static uint          cachedTick;
+static BOOL          isCached;
+static BOOL          isCachedSmooth;
+
+// Internal variables for the gradient texture
+static SDL_Texture * pTexture;
+static uint          gradientOffset;
+static BOOL          hasGradient;
+
+// Internal functions
+
+// Write a quad covering the rectangle
+// The texture coordinate is 'u' at the point (centreX, centreY)
+// and changes by stepX and stepY per pixel
+static void WriteQuad(SDL_Vertex * pVertex, const SDL_Rect * pRect, const float centreX, const float centreY,
+                      const float u, const float stepX, const float stepY)
+{
+    for(int corner = 0; corner < 4; corner++)
+    {
+        const float X = (float)(pRect->x + ((corner & 1) ? pRect->w : 0));
+        const float Y = (float)(pRect->y + ((corner & 2) ? pRect->h : 0));
+        pVertex[corner].position.x  = X;
+        pVertex[corner].position.y  = Y;
+        pVertex[corner].color.r     = 255;
+        pVertex[corner].color.g     = 255;
+        pVertex[corner].color.b     = 255;
+        pVertex[corner].color.a     = SDL_ALPHA_OPAQUE;
+        pVertex[corner].tex_coord.x = u + ((X - centreX) * stepX) + ((Y - centreY) * stepY);
+        pVertex[corner].tex_coord.y = 0.5f;
+    }
+}
+
+// Collapse a quad to a point so that it covers nothing
+static void WriteEmptyQuad(SDL_Vertex * pVertex)
+{
+    SDL_Rect r;
+    r.x = 0;
+    r.y = 0;
+    r.w = 0;
+    r.h = 0;
+    WriteQuad(pVertex, &r, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+}
+
+// Write the connection from cell a towards its neighbour b
+// Same rectangles as the rectangles renderer. Smooth quads move
+// 'slotStep' colour slots over the cell towards the neighbour
+static void WriteConnector(SDL_Vertex * pVertex, const Point a, const Point b, const float u, const float slotStep)
+{
+    const short PADDING = (CELL_SIZE / 5);
+    const int DIFF_X = SnapshotStepBetween(a.x, b.x);
+    const int DIFF_Y = SnapshotStepBetween(a.y, b.y);
+
+    SDL_Rect r;
+    r.x = offsetX + (a.x * CELL_SIZE) + PADDING;
+    r.y = offsetY + (a.y * CELL_SIZE) + PADDING;
+    if(DIFF_X != 0)
+    {
+        r.w = PADDING * 4;
+        r.h = PADDING * 3;
+        r.x = (DIFF_X == 1) ? r.x - PADDING : r.x;
+    }
+    else if(DIFF_Y != 0)
+    {
+        r.w = PADDING * 3;
+        r.h = PADDING * 4;
+        r.y = (DIFF_Y == 1) ? r.y - PADDING : r.y;
+    }
+    else
+    {
+        WriteEmptyQuad(pVertex);
+        return;
+    }
+
+    const float CENTRE_X = (float)offsetX + ((float)a.x + 0.5f) * CELL_SIZE;
+    const float CENTRE_Y = (float)offsetY + ((float)a.y + 0.5f) * CELL_SIZE;
+    const float STEP = isCachedSmooth ? slotStep / (float)(GRADIENT_WIDTH * CELL_SIZE) : 0.0f;
+    WriteQuad(pVertex, &r, CENTRE_X, CENTRE_Y, u, -DIFF_X * STEP, -DIFF_Y * STEP);
+}
+
+// Write both quads of the part at position i
+static void WritePart(const Snapshot * pSnapshot, const uint i)
+{
+    const Point * pBodyArr = pSnapshot->pBodyArr;
+    const RingPart * pPart = SnakeRingAt(&ring, i);
+    SDL_Vertex * pVertex = &pVertexArr[(pPart - ring.pPartArr) * PART_VERTICES];
+    const float U = ((float)pPart->slot + 1.5f) / GRADIENT_WIDTH;
+
+    if(pSnapshot->length == 1)
+    {
+        // Snake is 1 cell big. Draw a simple square
+        SDL_Rect r;
+        r.x = offsetX + (pBodyArr[i].x * CELL_SIZE) + (CELL_SIZE / 5);
+        r.y = offsetY + (pBodyArr[i].y * CELL_SIZE) + (CELL_SIZE / 5);
+        r.w = (CELL_SIZE / 5) * 3;
+        r.h = (CELL_SIZE / 5) * 3;
+        WriteQuad(pVertex, &r, 0.0f, 0.0f, U, 0.0f, 0.0f);
+        WriteEmptyQuad(pVertex + 4);
+        return;
+    }
+
+    // The next part was laid a tick earlier, the previous one a tick later
+    if(i + 1 < pSnapshot->length)
+    {
+        WriteConnector(pVertex, pBodyArr[i], pBodyArr[i + 1], U, -1.0f);
+    }
+    else
+    {
+        WriteEmptyQuad(pVertex);
+    }
+    if(i > 0)
+    {
+        WriteConnector(pVertex + 4, pBodyArr[i], pBodyArr[i - 1], U, 1.0f);
+    }
+    else
+    {
+        WriteEmptyQuad(pVertex + 4);
+    }
+}
+
+// Write the whole snake, used after a reset or when the mesh is out of step
+static void Rebuild(const Snapshot * pSnapshot)
+{
+    SnakeRingAssign(&ring, pSnapshot);
+    for(uint i = 0; i < pSnapshot->length; i++)
+    {
+        WritePart(pSnapshot, i);
+    }
+}
+
+// Bring the mesh in line with the snapshot
+// Only the parts that changed since the last snapshot are written
+static void Update(const Snapshot * pSnapshot)
+{
+    const uint LENGTH = pSnapshot->length;
+    const uint TICKS = pSnapshot->tickCount - cachedTick;
+    if(!isCached || pSnapshot->gameId != cachedGameId || pSnapshot->tickCount < cachedTick
+    || !SnakeRingCanFollow(&ring, pSnapshot, TICKS))
+    {
+        Rebuild(pSnapshot);
+        return;
+    }
+    const uint MOVES = SnakeRingCountMoves(&ring, pSnapshot, TICKS);
+    if(MOVES > TICKS)
+    {
+        Rebuild(pSnapshot);
+        return;
+    }
+    if(MOVES == 0 && LENGTH == ring.count)
+    {
+        return;
+    }
+
+    SnakeRingPushHeads(&ring, pSnapshot, MOVES);
+    while(SnakeRingHasStaleTail(&ring, pSnapshot, MOVES))
+    {
+        SnakeRingPopTail(&ring);
+    }
+    SnakeRingPushGrownTail(&ring, pSnapshot);
+    if(!SnakeRingMatches(&ring, pSnapshot))
+    {
+        Rebuild(pSnapshot);
+        return;
+    }
+
+    // The new heads and the joint of the old head, then the tail,
+    // which may have lost its connection or gained parts by growing
+    for(uint i = 0; i <= MOVES && i < LENGTH; i++)
+    {
+        WritePart(pSnapshot, i);
+    }
+    for(uint i = SnakeRingTailStart(pSnapshot); i < LENGTH; i++)
+    {
+        WritePart(pSnapshot, i);
+    }
+}
+
+// Allocate the ring, vertices and indices for a board
+// Return FALSE if out of memory
+static BOOL Allocate(const ushort width, const ushort height)
+{
+    SnakeMeshFree();
+    boardWidth  = width;
+    boardHeight = height;
+    if(!SnakeRingInitialise(&ring, width, height))
+    {
+        return FALSE;
+    }
+    pVertexArr = (SDL_Vertex *)malloc(ring.capacity * PART_VERTICES * sizeof(SDL_Vertex));
+    pIndexArr  = (int *)malloc(ring.capacity * PART_INDICES * sizeof(int));
+    pTexture   = SDL_CreateTexture(GetRenderer(), SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, GRADIENT_WIDTH, 1);
+    if(!pVertexArr || !pIndexArr || !pTexture)
+    {
+        return FALSE;
+    }
+    SDL_SetTextureScaleMode(pTexture, SDL_ScaleModeNearest);
+
+    // Two triangles per quad, see WriteQuad() for the corner order
+    const int QUAD_INDICES[6] = { 0, 1, 2, 2, 1, 3 };
+    for(uint part = 0; part < ring.capacity; part++)
+    {
+        for(uint i = 0; i < PART_INDICES; i++)
+        {
+            pIndexArr[(part * PART_INDICES) + i] = (int)((part * PART_VERTICES) + ((i / 6) * 4)) + QUAD_INDICES[i % 6];
+        }
+    }
+    return TRUE;
+}
+
+// Rotate the gradient so that slot s shows colour (offset - s)
+static void SetGradient(const RGB * pColourArr, const uint offset)
+{
+    Uint32 texelArr[GRADIENT_WIDTH];
+    for(uint slot = 0; slot < SNAKE_COLOUR_COUNT; slot++)
+    {
+        const RGB COLOUR = pColourArr[(offset + SNAKE_COLOUR_COUNT - slot) % SNAKE_COLOUR_COUNT];
+        texelArr[slot + 1] = FramebufferMakeColour(COLOUR.r, COLOUR.g, COLOUR.b, SDL_ALPHA_OPAQUE);
+    }
+    texelArr[0] = texelArr[SNAKE_COLOUR_COUNT];
+    texelArr[GRADIENT_WIDTH - 1] = texelArr[1];
+    SDL_UpdateTexture(pTexture, NULL, texelArr, sizeof(texelArr));
+    gradientOffset = offset;
+    hasGradient    = TRUE;
+}
+
+// Public functions
+
+// Draw the snake from a snapshot as a triangle mesh
+// Return FALSE if the mesh cannot be created or drawn on this backend
+BOOL SnakeMeshDraw(const Snapshot * pSnapshot, const RGB * pColourArr, const BOOL isSmooth)
+{
+    if(RendererGetBackend() != cBackendAccelerated)
+    {
+        return FALSE;
+    }
+    if(!pTexture || pSnapshot->width != boardWidth || pSnapshot->height != boardHeight)
+    {
+        if(!Allocate(pSnapshot->width, pSnapshot->height))
+        {
+            SnakeMeshFree();
+            return FALSE;
+        }
+    }
+    if(pSnapshot->length == 0)
+    {
+        return TRUE;
+    }
+
+    // Vertices are in window coordinates, moving the board or
+    // changing the shading writes all of them again
+    int windowWidth = 0;
+    int windowHeight = 0;
+    RendererGetWindowSize(&windowWidth, &windowHeight);
+    const int OFFSET_X = (windowWidth / 2) - ((boardWidth * CELL_SIZE) / 2);
+    const int OFFSET_Y = (windowHeight / 2) - ((boardHeight * CELL_SIZE) / 2);
+    if(OFFSET_X != offsetX || OFFSET_Y != offsetY || isSmooth != isCachedSmooth)
+    {
+        SDL_SetTextureScaleMode(pTexture, isSmooth ? SDL_ScaleModeLinear : SDL_ScaleModeNearest);
+        offsetX        = OFFSET_X;
+        offsetY        = OFFSET_Y;
+        isCachedSmooth = isSmooth;
+        isCached       = FALSE;
+    }
+
+    Update(pSnapshot);
+    cachedGameId = pSnapshot->gameId;
+    cachedTick   = pSnapshot->tickCount;
+    isCached     = TRUE;
+
+    const uint OFFSET = pSnapshot->tickCount % SNAKE_COLOUR_COUNT;
+    if(!hasGradient || OFFSET != gradientOffset)
+    {
+        SetGradient(pColourArr, OFFSET);
+    }
+
+    // The live parts run from the head to the end of the buffer,
+    // and wrap around to its start
+    const int VERTEX_COUNT = (int)(ring.capacity * PART_VERTICES);
+    const uint FIRST = ring.headPos;
+    const uint RUN = (FIRST + ring.count <= ring.capacity) ? ring.count : ring.capacity - FIRST;
+    if(SDL_RenderGeometry(GetRenderer(), pTexture, pVertexArr, VERTEX_COUNT,
+                          &pIndexArr[FIRST * PART_INDICES], (int)(RUN * PART_INDICES)) != 0)
+    {
+        return FALSE;
+    }
+    if(RUN < ring.count)
+    {
+        SDL_RenderGeometry(GetRenderer(), pTexture, pVertexArr, VERTEX_COUNT,
+                           pIndexArr, (int)((ring.count - RUN) * PART_INDICES));
+    }
+    return TRUE;
+}
+
+// Free the mesh
+// Must be called before the renderer is freed
+void SnakeMeshFree(void)
+{
+    if(pTexture)
+    {
+        SDL_DestroyTexture(pTexture);
+        pTexture = NULL;
+    }
+    free(pVertexArr);
+    free(pIndexArr);
+    pVertexArr = NULL;
+    pIndexArr  = NULL;
+    SnakeRingFree(&ring);
+    isCached       = FALSE;
+    isCachedSmooth = FALSE;
+    hasGradient    = FALSE;
+}
@@ -0,0 +1,24 @@
+#ifndef SNAKEMESH_H
+#define SNAKEMESH_H
+
+#include "types.h"
+#include "snapshot.h"
+
+// Snake drawn as one triangle mesh
+//
+// Every part is two quads, the same rectangles the rectangles renderer fills,
+// kept in a ring of vertices that mirrors the body. A new snapshot only
+// rewrites the quads of the new heads, the old head and the tail, and the
+// live part of the ring is submitted with SDL_RenderGeometry() (two calls
+// when it wraps around the end of the buffer).
+//
+// Vertices sample a small gradient texture by the colour slot of their part,
+// and the texture is rotated by the tick count, so the rainbow flows along
+// the snake without touching the vertices. Smooth quads blend towards the
+// neighbouring colours at the cell edges. Accelerated backend only
+
+// Main functions
+BOOL SnakeMeshDraw(const Snapshot * pSnapshot, const RGB * pColourArr, const BOOL isSmooth);
+void SnakeMeshFree(void);
+
+#endif // !SNAKEMESH_H
@@ -0,0 +1,173 @@
+#ifndef SNAKERING_H
+#define SNAKERING_H
+
+#include <stdlib.h>
+
+#include "types.h"
+#include "globals.h"
+#include "snapshot.h"
+
+// Body ring shared by the cached snake renderers
+//
+// Mirrors the body of the last drawn snapshot, head first. Every part keeps
+// the colour slot of the tick at which it was (or would have been) the head,
+// so a part's slot does not change while it moves down the body. A renderer
+// following the snapshots pushes the new heads, pops the stale tail parts
+// and appends the parts added by growing, touching O(1) parts per tick.
+// The heads are pushed per move, not per tick, see SnakeRingCountMoves()
+typedef struct
+{
+    Point point;
+    uchar slot;   // Colour slot, (tick the part was laid) % SNAKE_COLOUR_COUNT
+} RingPart;
+
+typedef struct
+{
+    RingPart * pPartArr;
+    uint       capacity;
+    uint       headPos;
+    uint       count;
+} SnakeRing;
+
+// Allocate a ring for every cell of a board
+// Return FALSE if out of memory
+static inline BOOL SnakeRingInitialise(SnakeRing * pRing, const ushort width, const ushort height)
+{
+    pRing->capacity = (uint)width * height + 2;
+    pRing->headPos  = 0;
+    pRing->count    = 0;
+    pRing->pPartArr = (RingPart *)malloc(pRing->capacity * sizeof(RingPart));
+    return (pRing->pPartArr != NULL);
+}
+
+static inline void SnakeRingFree(SnakeRing * pRing)
+{
+    free(pRing->pPartArr);
+    pRing->pPartArr = NULL;
+    pRing->capacity = 0;
+    pRing->count    = 0;
+}
+
+// Return the part at position i from the head
+static inline RingPart * SnakeRingAt(const SnakeRing * pRing, const uint i)
+{
+    return &pRing->pPartArr[(pRing->headPos + i) % pRing->capacity];
+}
+
+// Return the colour slot of the part at position i of a snapshot taken at 'tick'
+static inline uchar SnakeRingSlot(const uint tick, const uint i)
+{
+    return (uchar)(((tick % SNAKE_COLOUR_COUNT) + SNAKE_COLOUR_COUNT - (i % SNAKE_COLOUR_COUNT)) % SNAKE_COLOUR_COUNT);
+}
+
+static inline void SnakeRingPushHead(SnakeRing * pRing, const Point point, const uchar slot)
+{
+    pRing->headPos = (pRing->headPos + pRing->capacity - 1) % pRing->capacity;
+    SnakeRingAt(pRing, 0)->point = point;
+    SnakeRingAt(pRing, 0)->slot  = slot;
+    pRing->count++;
+}
+
+static inline void SnakeRingPushTail(SnakeRing * pRing, const Point point, const uchar slot)
+{
+    SnakeRingAt(pRing, pRing->count)->point = point;
+    SnakeRingAt(pRing, pRing->count)->slot  = slot;
+    pRing->count++;
+}
+
+// Remove the tail part and return its cell
+static inline Point SnakeRingPopTail(SnakeRing * pRing)
+{
+    pRing->count--;
+    return SnakeRingAt(pRing, pRing->count)->point;
+}
+
+// Fill the ring with the whole body of a snapshot
+static inline void SnakeRingAssign(SnakeRing * pRing, const Snapshot * pSnapshot)
+{
+    pRing->headPos = 0;
+    pRing->count   = 0;
+    for(uint i = 0; i < pSnapshot->length; i++)
+    {
+        SnakeRingPushTail(pRing, pSnapshot->pBodyArr[i], SnakeRingSlot(pSnapshot->tickCount, i));
+    }
+}
+
+// Return TRUE if the ring can follow a snapshot taken 'ticks' ticks
+// after its own, FALSE if it has to be assigned again
+static inline BOOL SnakeRingCanFollow(const SnakeRing * pRing, const Snapshot * pSnapshot, const uint ticks)
+{
+    return pSnapshot->length > 0 && ticks < pSnapshot->length && pRing->count + ticks <= pRing->capacity;
+}
+
+// Return the number of times the snake has moved between the ring's
+// snapshot and one taken 'ticks' ticks later, found from where the ring's
+// head is in the new body. Only valid if SnakeRingCanFollow()
+// Ticks that only warn do not move the snake, so it can be fewer than
+// the ticks in between. With fewer ticks than parts the head cannot
+// have come back to its old cell, so the first match is the one
+// Return 'ticks' + 1 if the head is not found
+static inline uint SnakeRingCountMoves(const SnakeRing * pRing, const Snapshot * pSnapshot, const uint ticks)
+{
+    const Point HEAD = SnakeRingAt(pRing, 0)->point;
+    uint moves = 0;
+    while(moves <= ticks && moves < pSnapshot->length && !PointsAreEqual(pSnapshot->pBodyArr[moves], HEAD))
+    {
+        moves++;
+    }
+    return (moves < pSnapshot->length) ? moves : ticks + 1;
+}
+
+// Push the heads a snapshot has gained in 'moves' moves
+static inline void SnakeRingPushHeads(SnakeRing * pRing, const Snapshot * pSnapshot, const uint moves)
+{
+    for(uint i = moves; i > 0; i--)
+    {
+        SnakeRingPushHead(pRing, pSnapshot->pBodyArr[i - 1], SnakeRingSlot(pSnapshot->tickCount, i - 1));
+    }
+}
+
+// Return TRUE while the ring keeps tail parts the snapshot has lost
+// after its heads were pushed for 'moves' moves
+// Growing pops the tail and then appends a copy of the new tail,
+// so the tails have to match and not only the lengths
+static inline BOOL SnakeRingHasStaleTail(const SnakeRing * pRing, const Snapshot * pSnapshot, const uint moves)
+{
+    const Point TAIL = pSnapshot->pBodyArr[pSnapshot->length - 1];
+    return pRing->count > pSnapshot->length
+        || (pRing->count > moves + 1 && !PointsAreEqual(SnakeRingAt(pRing, pRing->count - 1)->point, TAIL));
+}
+
+// Append the parts the snapshot has gained by growing
+static inline void SnakeRingPushGrownTail(SnakeRing * pRing, const Snapshot * pSnapshot)
+{
+    while(pRing->count < pSnapshot->length)
+    {
+        SnakeRingPushTail(pRing, pSnapshot->pBodyArr[pRing->count], SnakeRingSlot(pSnapshot->tickCount, pRing->count));
+    }
+}
+
+// Return TRUE if the ring has the head and tail of the snapshot
+static inline BOOL SnakeRingMatches(const SnakeRing * pRing, const Snapshot * pSnapshot)
+{
+    const uint LAST = pSnapshot->length - 1;
+    return pRing->count == pSnapshot->length
+        && PointsAreEqual(SnakeRingAt(pRing, 0)->point, pSnapshot->pBodyArr[0])
+        && PointsAreEqual(SnakeRingAt(pRing, LAST)->point, pSnapshot->pBodyArr[LAST]);
+}
+
+// Return the position of the first part sharing the tail's cell
+// Parts added by growing stay in the tail's cell until it moves on
+static inline uint SnakeRingTailStart(const Snapshot * pSnapshot)
+{
+    const Point * pBodyArr = pSnapshot->pBodyArr;
+    const uint LAST = pSnapshot->length - 1;
+    uint first = LAST;
+    while(first > 0 && PointsAreEqual(pBodyArr[first - 1], pBodyArr[LAST]))
+    {
+        first--;
+    }
+    return first;
+}
+
+#endif // !SNAKERING_H
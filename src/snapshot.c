@@ -0,0 +1,168 @@
+#include "snapshot.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
+#include "snake.h"
+
+// Internal functions
+
+// Return the snapshot cell of a point, the wall border included
+static inline uchar * CellOf(const Snapshot * pSnapshot, const Point point)
+{
+    return pSnapshot->pCellArr + ((point.y + 1) * (pSnapshot->width + 2)) + point.x + 1;
+}
+
+// Copy every cell and the whole body
+// Board rows are copied straight from the cell storage; the wall rows above
+// and below the board are stored too, only the side walls are filled in
+static void CaptureAll(Snapshot * pSnapshot)
+{
+    const uchar * pCells = BoardGetCells();
+    const uint WIDTH = pSnapshot->width;
+    uchar * pRow = pSnapshot->pCellArr;
+    for(uint y = 0; y < pSnapshot->height + 2u; y++, pRow += WIDTH + 2)
+    {
+        pRow[0]         = cTypeWall;
+        pRow[WIDTH + 1] = cTypeWall;
+#if BOARD_CELL_BITS == 8
+        memcpy(pRow + 1, pCells + ((size_t)y * BoardGetRowStride()), WIDTH);
+#else
+        const uint FIRST = y * BoardGetRowCells();
+        for(uint x = 0; x < WIDTH; x++)
+        {
+            pRow[x + 1] = (uchar)BoardReadCellFrom(pCells, FIRST + x);
+        }
+#endif // BOARD_CELL_BITS
+    }
+
+    uint length = 0;
+    for(SnakePart * pCurrent = SnakeGetHead(); pCurrent && length <= pSnapshot->capacity; pCurrent = pCurrent->pNext)
+    {
+        pSnapshot->pBodyArr[length++] = BoardToPoint(pCurrent->index);
+    }
+    pSnapshot->length = length;
+}
+
+// Bring a snapshot of an earlier tick of the same game up to date
+// The body is a queue: every move pushed a head and popped a tail part,
+// and every meal pushed a copy of the tail. The new body is then the new
+// heads, the start of the old body and at most one part per meal at the
+// end, and only those parts, the cells left by the tail and the food are
+// read from the board
+// Return FALSE if the snapshot cannot follow, it must then be captured again
+static BOOL CaptureChanges(Snapshot * pSnapshot, const uint ticks)
+{
+    const uint OLD_LENGTH = pSnapshot->length;
+    const uint LENGTH = SnakeGetLength();
+    if(LENGTH < OLD_LENGTH || LENGTH > pSnapshot->capacity + 1)
+    {
+        return FALSE;
+    }
+
+    // Ticks that only warn do not move the snake, so the moves are found
+    // from where the old head is in the new body. With fewer ticks than
+    // parts the head cannot have come back to its old cell, so the first
+    // match is the one
+    const SnakePart * pCurrent = SnakeGetHead();
+    uint moves = 0;
+    while(pCurrent && moves <= ticks && !PointsAreEqual(BoardToPoint(pCurrent->index), pSnapshot->pBodyArr[0]))
+    {
+        pCurrent = pCurrent->pNext;
+        moves++;
+    }
+    if(!pCurrent || moves > ticks)
+    {
+        return FALSE;
+    }
+
+    // Cells the tail may have left, and the old and new food
+    for(uint i = (moves < OLD_LENGTH) ? OLD_LENGTH - moves : 0; i < OLD_LENGTH; i++)
+    {
+        *CellOf(pSnapshot, pSnapshot->pBodyArr[i]) = (uchar)BoardGetCell(pSnapshot->pBodyArr[i]);
+    }
+    if(pSnapshot->food.x >= 0)
+    {
+        *CellOf(pSnapshot, pSnapshot->food) = (uchar)BoardGetCell(pSnapshot->food);
+    }
+    const Point FOOD = BoardGetFood();
+    if(FOOD.x >= 0)
+    {
+        *CellOf(pSnapshot, FOOD) = (uchar)BoardGetCell(FOOD);
+    }
+
+    // The new heads in front of the old body, then the parts pushed by
+    // meals read back from the tail
+    const uint KEPT = (OLD_LENGTH < LENGTH - moves) ? OLD_LENGTH : LENGTH - moves;
+    memmove(pSnapshot->pBodyArr + moves, pSnapshot->pBodyArr, KEPT * sizeof(Point));
+    pCurrent = SnakeGetHead();
+    for(uint i = 0; i < moves; i++, pCurrent = pCurrent->pNext)
+    {
+        pSnapshot->pBodyArr[i] = BoardToPoint(pCurrent->index);
+        *CellOf(pSnapshot, pSnapshot->pBodyArr[i]) = (uchar)BoardReadCellFrom(BoardGetCells(), pCurrent->index);
+    }
+    const uint MEALS = LENGTH - OLD_LENGTH;
+    const uint READ = (MEALS < LENGTH - moves) ? MEALS : LENGTH - moves;
+    pCurrent = SnakeGetTail();
+    for(uint i = LENGTH; i > LENGTH - READ; i--, pCurrent = pCurrent->pPrev)
+    {
+        pSnapshot->pBodyArr[i - 1] = BoardToPoint(pCurrent->index);
+    }
+    pSnapshot->length = LENGTH;
+    return TRUE;
+}
+
+// Public functions
+
+// "Constructor"
+// Allocate the arrays for a board of the given size
+// The cells include the wall border around the board
+// Right after eating, the tail is doubled up, so the body holds one extra point
+// Return FALSE if the arrays cannot be allocated
+BOOL SnapshotInitialise(Snapshot * pSnapshot, const ushort width, const ushort height)
+{
+    memset(pSnapshot, 0, sizeof(Snapshot));
+    pSnapshot->capacity = (uint)width * height;
+    pSnapshot->pCellArr = (uchar *)calloc((size_t)(width + 2) * (height + 2), sizeof(uchar));
+    pSnapshot->pBodyArr = (Point *)calloc(pSnapshot->capacity + 1, sizeof(Point));
+    if(!pSnapshot->pCellArr || !pSnapshot->pBodyArr)
+    {
+        SnapshotFree(pSnapshot);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+// "Destructor"
+void SnapshotFree(Snapshot * pSnapshot)
+{
+    free(pSnapshot->pCellArr);
+    free(pSnapshot->pBodyArr);
+    memset(pSnapshot, 0, sizeof(Snapshot));
+}
+
+// Copy the current board, snake and score into the snapshot
+// A snapshot of an earlier tick of the same game only takes the cells
+// and parts that changed since, so publishing does not depend on the
+// board size or the snake's length
+// The board must not be larger than the snapshot was initialised for
+void SnapshotCapture(Snapshot * pSnapshot, const uint gameId, const TickResult result)
+{
+    const uint TICK_COUNT = SimulationGetTickCount();
+    const uint TICKS = TICK_COUNT - pSnapshot->tickCount;
+    const BOOL CAN_FOLLOW = pSnapshot->length > 0 && pSnapshot->gameId == gameId && TICK_COUNT >= pSnapshot->tickCount
+                         && TICKS < pSnapshot->length && pSnapshot->width == BoardGetWidth() && pSnapshot->height == BoardGetHeight();
+    pSnapshot->width  = BoardGetWidth();
+    pSnapshot->height = BoardGetHeight();
+    if(!CAN_FOLLOW || !CaptureChanges(pSnapshot, TICKS))
+    {
+        CaptureAll(pSnapshot);
+    }
+
+    pSnapshot->gameId    = gameId;
+    pSnapshot->score     = SimulationGetScore();
+    pSnapshot->tickCount = TICK_COUNT;
+    pSnapshot->result    = result;
+    pSnapshot->food      = BoardGetFood();
+}
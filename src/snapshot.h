@@ -0,0 +1,44 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "types.h"
+#include "simulation.h"
+
+// Copy of everything needed to draw one simulation state
+// Snapshots are filled on the simulation side and only read when drawing,
+// so the renderer never touches the live board or snake
+typedef struct
+{
+    uint       gameId;     // Incremented on every reset
+    ushort     width;
+    ushort     height;
+    uint       score;
+    uint       tickCount;
+    TickResult result;     // Result of the last tick
+    Point      food;
+    unsigned long long moveTime;    // Performance counter at the tick that moved the snake here, 0 if it did not move
+    unsigned long long tickPeriod;  // Performance counter ticks between two moves
+    Point      vacated;    // Cell the tail left on that tick, {-1, -1} if it stayed
+    unsigned long long inputTime;      // Key press of the last input applied by a tick, 0 if none (see latency.h)
+    unsigned long long inputTickTime;  // Performance counter at the tick that applied it
+    uint       length;     // Number of points in pBodyArr
+    uint       capacity;   // Number of cells the arrays were allocated for
+    uchar *    pCellArr;   // Celltype values with the wall border, (width + 2) * (height + 2), row-major
+    Point *    pBodyArr;   // Snake cells from head to tail
+} Snapshot;
+
+// Return the difference between the coordinates of two neighbouring
+// body cells: -1, 0 or 1. Neighbours across the edge of a wrapping
+// board are a whole board apart, so they count as a step the other way
+static inline int SnapshotStepBetween(const int a, const int b)
+{
+    const int DIFF = a - b;
+    return (DIFF > 1) ? -1 : (DIFF < -1) ? 1 : DIFF;
+}
+
+// Main functions
+BOOL SnapshotInitialise(Snapshot * pSnapshot, const ushort width, const ushort height);
+void SnapshotFree(Snapshot * pSnapshot);
+void SnapshotCapture(Snapshot * pSnapshot, const uint gameId, const TickResult result);
+
+#endif // !SNAPSHOT_H
@@ -0,0 +1,421 @@
+#include "space.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
+#include "snake.h"
+
+// Label of cells that are not open, also marks the end of a search
+#define NO_REGION ((uint)-1)
+
+// One search per side of a closed cell
+#define MAX_SEARCHES 4
+
+// Breadth-first search over one region
+// Visited cells are chained through pLinkArr in visiting order
+typedef struct
+{
+    uint first;
+    uint last;
+    uint next;    // Next cell to expand, NO_REGION once exhausted
+    uint count;
+    uint group;   // Searches that have met share a group
+} Search;
+
+// Internal variables
+ENGINE_STATE uint * pLabelArr = NULL;   // Region of every cell, NO_REGION if not open
+ENGINE_STATE uint * pSizeArr;           // Open cells in every region
+ENGINE_STATE uint * pUnusedArr;         // Stack of unused region labels
+ENGINE_STATE uint * pLinkArr;           // Search chains, or the relabelling stack
+ENGINE_STATE uint * pVisitArr;          // (pass * MAX_SEARCHES) + search that visited the cell
+ENGINE_STATE uint   unusedCount;
+ENGINE_STATE uint   cellCount;
+ENGINE_STATE uint   rowCells;
+ENGINE_STATE uint   pass;
+ENGINE_STATE uint   tailIndex;
+ENGINE_STATE Search searchArr[MAX_SEARCHES];
+
+// Internal functions
+
+// Return TRUE if the cell is open
+// Cells off the board are either padding walls or out of range
+static inline BOOL IsOpen(const uint index)
+{
+    return (index < cellCount) && (pLabelArr[index] != NO_REGION);
+}
+
+static uint NewLabel(void)
+{
+    const uint LABEL = pUnusedArr[--unusedCount];
+    pSizeArr[LABEL] = 0;
+    return LABEL;
+}
+
+static void ReleaseLabel(const uint label)
+{
+    pUnusedArr[unusedCount++] = label;
+}
+
+// Give every cell of the region containing 'index' a new label
+// O(size of the region)
+static void Relabel(const uint index, const uint label)
+{
+    const uint OLD_LABEL = pLabelArr[index];
+    const uint OFFSET_ARR[4] = { -rowCells, rowCells, (uint)-1, 1 };
+    uint count = 0;
+    pLabelArr[index] = label;
+    pLinkArr[count++] = index;
+    while(count > 0)
+    {
+        const uint CURRENT = pLinkArr[--count];
+        for(uint side = 0; side < 4; side++)
+        {
+            const uint NEXT = CURRENT + OFFSET_ARR[side];
+            if(NEXT < cellCount && pLabelArr[NEXT] == OLD_LABEL)
+            {
+                pLabelArr[NEXT] = label;
+                pLinkArr[count++] = NEXT;
+            }
+        }
+    }
+    pSizeArr[label] += pSizeArr[OLD_LABEL];
+    ReleaseLabel(OLD_LABEL);
+}
+
+// Start a new search pass, forgetting the cells visited by earlier ones
+static void BeginPass(void)
+{
+    pass++;
+    if(pass >= NO_REGION / MAX_SEARCHES)
+    {
+        memset(pVisitArr, 0, cellCount * sizeof(uint));
+        pass = 1;
+    }
+}
+
+// Return the search that visited the cell in this pass, or NO_REGION
+static inline uint VisitorOf(const uint index)
+{
+    return (pVisitArr[index] / MAX_SEARCHES == pass) ? pVisitArr[index] % MAX_SEARCHES : NO_REGION;
+}
+
+static void Visit(const uint s, const uint index)
+{
+    Search * pSearch = &searchArr[s];
+    pVisitArr[index] = (pass * MAX_SEARCHES) + s;
+    if(pSearch->count == 0)
+    {
+        pSearch->first = index;
+    }
+    else
+    {
+        pLinkArr[pSearch->last] = index;
+    }
+    pSearch->last = index;
+    pSearch->count++;
+}
+
+// Return the group a search belongs to
+static uint GroupOf(uint s)
+{
+    while(searchArr[s].group != s)
+    {
+        s = searchArr[s].group;
+    }
+    return s;
+}
+
+// Expand the next cell of search s
+// Neighbours visited by another search join the two groups
+static void Expand(const uint s, const uint label)
+{
+    const uint OFFSET_ARR[4] = { -rowCells, rowCells, (uint)-1, 1 };
+    Search * pSearch = &searchArr[s];
+    const uint CURRENT = pSearch->next;
+    for(uint side = 0; side < 4; side++)
+    {
+        const uint NEXT = CURRENT + OFFSET_ARR[side];
+        if(NEXT >= cellCount || pLabelArr[NEXT] != label)
+        {
+            continue;
+        }
+        const uint VISITOR = VisitorOf(NEXT);
+        if(VISITOR == NO_REGION)
+        {
+            Visit(s, NEXT);
+        }
+        else if(GroupOf(VISITOR) != GroupOf(s))
+        {
+            searchArr[GroupOf(VISITOR)].group = GroupOf(s);
+        }
+    }
+    pSearch->next = (CURRENT == pSearch->last) ? NO_REGION : pLinkArr[CURRENT];
+}
+
+// Return TRUE if any search of the group can still grow
+static BOOL IsGroupGrowing(const uint group, const uint searchCount)
+{
+    for(uint s = 0; s < searchCount; s++)
+    {
+        if(searchArr[s].next != NO_REGION && GroupOf(s) == group)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+// Find the sides of a cell whose open neighbours are not connected
+// through the ring of eight cells around it, one seed per run of sides
+// Return the number of seeds
+static uint FindSeparatedSides(const uint index, uint * pSeedArr)
+{
+    // Sides clockwise from the top, corner i lies between side i and side i + 1
+    const uint SIDE_ARR[4]   = { index - rowCells, index + 1, index + rowCells, index - 1 };
+    const uint CORNER_ARR[4] = { index - rowCells + 1, index + rowCells + 1, index + rowCells - 1, index - rowCells - 1 };
+    BOOL isLinkedArr[4];
+    for(uint i = 0; i < 4; i++)
+    {
+        isLinkedArr[i] = IsOpen(SIDE_ARR[i]) && IsOpen(SIDE_ARR[(i + 1) % 4]) && IsOpen(CORNER_ARR[i]);
+    }
+
+    uint seedCount = 0;
+    for(uint i = 0; i < 4; i++)
+    {
+        if(IsOpen(SIDE_ARR[i]) && !isLinkedArr[(i + 3) % 4])
+        {
+            pSeedArr[seedCount++] = SIDE_ARR[i];
+        }
+    }
+    return seedCount;
+}
+
+// Split a region whose cell has just been closed, if it falls apart
+// The searches run in turns until at most one group is growing;
+// every group that stopped growing is a region of its own
+static void Split(const uint label, const uint * pSeedArr, const uint seedCount)
+{
+    BeginPass();
+    for(uint s = 0; s < seedCount; s++)
+    {
+        searchArr[s].count = 0;
+        searchArr[s].group = s;
+        Visit(s, pSeedArr[s]);
+        searchArr[s].next = pSeedArr[s];
+    }
+
+    uint growingCount = seedCount;
+    while(growingCount > 1)
+    {
+        for(uint s = 0; s < seedCount; s++)
+        {
+            if(searchArr[s].next != NO_REGION)
+            {
+                Expand(s, label);
+            }
+        }
+        growingCount = 0;
+        for(uint s = 0; s < seedCount; s++)
+        {
+            growingCount += (GroupOf(s) == s && IsGroupGrowing(s, seedCount));
+        }
+    }
+
+    // The growing group keeps the label; if none is growing, the first group does
+    uint keptGroup = NO_REGION;
+    for(uint s = 0; s < seedCount; s++)
+    {
+        if(GroupOf(s) == s && (keptGroup == NO_REGION || IsGroupGrowing(s, seedCount)))
+        {
+            keptGroup = s;
+        }
+    }
+    for(uint group = 0; group < seedCount; group++)
+    {
+        if(GroupOf(group) != group || group == keptGroup)
+        {
+            continue;
+        }
+        const uint NEW_LABEL = NewLabel();
+        for(uint s = 0; s < seedCount; s++)
+        {
+            if(GroupOf(s) != group)
+            {
+                continue;
+            }
+            uint index = searchArr[s].first;
+            for(uint i = 0; i < searchArr[s].count; i++)
+            {
+                pLabelArr[index] = NEW_LABEL;
+                index = pLinkArr[index];
+            }
+            pSizeArr[NEW_LABEL] += searchArr[s].count;
+            pSizeArr[label]     -= searchArr[s].count;
+        }
+    }
+}
+
+// Make a cell open, joining the regions around it
+static void Open(const uint index)
+{
+    const uint SIDE_ARR[4] = { index - rowCells, index + rowCells, index - 1, index + 1 };
+
+    // The largest region around the cell absorbs the others
+    uint label = NO_REGION;
+    for(uint i = 0; i < 4; i++)
+    {
+        if(IsOpen(SIDE_ARR[i]) && (label == NO_REGION || pSizeArr[pLabelArr[SIDE_ARR[i]]] > pSizeArr[label]))
+        {
+            label = pLabelArr[SIDE_ARR[i]];
+        }
+    }
+    if(label == NO_REGION)
+    {
+        label = NewLabel();
+    }
+    for(uint i = 0; i < 4; i++)
+    {
+        if(IsOpen(SIDE_ARR[i]) && pLabelArr[SIDE_ARR[i]] != label)
+        {
+            Relabel(SIDE_ARR[i], label);
+        }
+    }
+    pLabelArr[index] = label;
+    pSizeArr[label]++;
+}
+
+// Make a cell closed, splitting its region if it falls apart
+static void Close(const uint index)
+{
+    const uint LABEL = pLabelArr[index];
+    pLabelArr[index] = NO_REGION;
+    if(--pSizeArr[LABEL] == 0)
+    {
+        ReleaseLabel(LABEL);
+        return;
+    }
+
+    uint seedArr[4];
+    const uint SEED_COUNT = FindSeparatedSides(index, seedArr);
+    if(SEED_COUNT > 1)
+    {
+        Split(LABEL, seedArr, SEED_COUNT);
+    }
+}
+
+// Public functions
+
+// "Constructor"
+// Allocate the labels for the current board and build the regions
+void SpaceInitialise(void)
+{
+    SpaceFree();
+
+    rowCells  = BoardGetRowCells();
+    cellCount = BoardGetCellCount();
+    pLabelArr  = (uint *)malloc(cellCount * sizeof(uint));
+    pSizeArr   = (uint *)malloc(cellCount * sizeof(uint));
+    pUnusedArr = (uint *)malloc(cellCount * sizeof(uint));
+    pLinkArr   = (uint *)malloc(cellCount * sizeof(uint));
+    pVisitArr  = (uint *)calloc(cellCount, sizeof(uint));
+    if(!pLabelArr || !pSizeArr || !pUnusedArr || !pLinkArr || !pVisitArr)
+    {
+        SpaceFree();
+        return;
+    }
+    pass = 0;
+    SpaceRebuild();
+}
+
+// "Destructor"
+void SpaceFree(void)
+{
+    free(pLabelArr);
+    free(pSizeArr);
+    free(pUnusedArr);
+    free(pLinkArr);
+    free(pVisitArr);
+    pLabelArr  = NULL;
+    pSizeArr   = NULL;
+    pUnusedArr = NULL;
+    pLinkArr   = NULL;
+    pVisitArr  = NULL;
+    cellCount  = 0;
+}
+
+// Build the regions from the board
+// O(cells). Used after a reset; SpaceUpdate() is usually O(1)
+void SpaceRebuild(void)
+{
+    if(!pLabelArr)
+    {
+        return;
+    }
+    if(rowCells != BoardGetRowCells() || cellCount != BoardGetCellCount())
+    {
+        SpaceInitialise();
+        return;
+    }
+
+    unusedCount = 0;
+    for(uint label = cellCount; label > 0; label--)
+    {
+        ReleaseLabel(label - 1);
+    }
+    for(uint index = 0; index < cellCount; index++)
+    {
+        pLabelArr[index] = NO_REGION;
+    }
+    for(uint index = 0; index < cellCount; index++)
+    {
+        if(!IsOpen(index) && BoardIsCellValidAt(index))
+        {
+            Open(index);
+        }
+    }
+    tailIndex = SnakeGetTail()->index;
+}
+
+// Apply the changes made by one simulation tick
+// Only the old tail and the new head change
+void SpaceUpdate(const TickResult result)
+{
+    if(!pLabelArr || result == cTickWarning || result == cTickDefeat)
+    {
+        // The snake did not move
+        return;
+    }
+
+    // The tail cell is only vacated if the board says so:
+    // after eating, the tail stays for one more move
+    if(!IsOpen(tailIndex) && BoardIsCellValidAt(tailIndex))
+    {
+        Open(tailIndex);
+    }
+    const uint HEAD_INDEX = SnakeGetHead()->index;
+    if(IsOpen(HEAD_INDEX))
+    {
+        Close(HEAD_INDEX);
+    }
+    tailIndex = SnakeGetTail()->index;
+}
+
+// Return the number of open cells connected to the cell, itself included
+// Return 0 if the cell is not open
+uint SpaceGetRegionSize(const uint index)
+{
+    return IsOpen(index) ? pSizeArr[pLabelArr[index]] : 0;
+}
+
+// Return TRUE if both cells are open and connected
+BOOL SpaceIsReachable(const uint fromIndex, const uint toIndex)
+{
+    return IsOpen(fromIndex) && IsOpen(toIndex) && pLabelArr[fromIndex] == pLabelArr[toIndex];
+}
+
+// Return the number of separate open regions
+uint SpaceGetRegionCount(void)
+{
+    return cellCount - unusedCount;
+}
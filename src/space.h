@@ -0,0 +1,31 @@
+#ifndef SPACE_H
+#define SPACE_H
+
+#include "types.h"
+#include "simulation.h"
+
+// Reachable free space
+//
+// Keeps the open cells of the board (free or food) split into connected
+// regions, so that survival heuristics can ask how much room a cell still
+// reaches without a flood fill per candidate move. Cells are board indices
+// (see BoardToIndex()).
+//
+// Opening a cell joins the regions around it by relabelling the smaller
+// ones. Closing a cell only searches when its open neighbours are not
+// connected around it; then one search starts on every side and they stop
+// once at most one side is still growing, so a split costs about the size
+// of the smaller part. Queries are O(1)
+
+// Main functions
+void SpaceInitialise(void);
+void SpaceFree(void);
+void SpaceUpdate(const TickResult result);
+void SpaceRebuild(void);
+
+// Queries
+uint SpaceGetRegionSize(const uint index);
+BOOL SpaceIsReachable(const uint fromIndex, const uint toIndex);
+uint SpaceGetRegionCount(void);
+
+#endif // !SPACE_H
@@ -0,0 +1,505 @@
+// Needed for sockets and stat() with -std=c99
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif // !_WIN32
+
+#include "spectator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL2/SDL.h>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif // !_WIN32
+
+#define MAX_SPECTATORS  8
+#define BACKLOG_SIZE    16384  // Queued bytes on top of one keyframe, about 1000 deltas
+#define POLL_INTERVAL   50     // Milliseconds between checks for new spectators
+#define KEYFRAME_SIZE   30     // Header and keyframe fields before the points
+#define DELTA_MAX_SIZE  24
+
+typedef struct
+{
+    int      socket;           // -1 if the slot is free
+    uchar *  pQueue;
+    uint     start;            // Queued bytes are [start, end)
+    uint     end;
+    Uint64   connectTime;
+    unsigned long long byteCount;
+} Spectator;
+
+// Internal variables for the server
+static int         serverSocket = -1;
+static char        socketPath[108];
+static Spectator   spectatorArr[MAX_SPECTATORS];
+static uint        queueSize;
+static uchar *     pKeyframe;
+static Uint32      nextPollTime;
+static uint        spectatorCount;
+static uint        droppedCount;
+static unsigned long long totalByteCount;
+
+// Internal variables for the mirrored state
+// The body is a ring, so a move only writes the new head
+static BOOL        hasState;
+static uint        gameId;
+static uint        tickCount;
+static uint        score;
+static uchar       result;
+static ushort      width;
+static ushort      height;
+static Point       food;
+static Point *     pBodyArr;
+static uint        bodySize;
+static uint        headPos;
+static uint        length;
+
+// Internal functions
+
+// Socket wrappers
+// There is no server on Windows, so those never get called there
+#ifdef _WIN32
+static int OpenServer(const char * pPath) { (void)pPath; return -1; }
+static int AcceptSpectator(void) { return -1; }
+static int SendSome(const int socket, const uchar * pData, const uint size) { (void)socket; (void)pData; (void)size; return -1; }
+static BOOL IsClosed(const int socket) { (void)socket; return TRUE; }
+static void CloseSocket(const int socket) { (void)socket; }
+static void RemoveSocketFile(const char * pPath) { (void)pPath; }
+#else
+// Return the socket switched to non-blocking, -1 if it is not valid
+static int MakeNonBlocking(const int socket)
+{
+    if(socket >= 0 && fcntl(socket, F_SETFL, fcntl(socket, F_GETFL) | O_NONBLOCK) != 0)
+    {
+        close(socket);
+        return -1;
+    }
+    return socket;
+}
+
+// Remove the socket file of an old server
+// Anything that is not a socket is left alone
+static void RemoveSocketFile(const char * pPath)
+{
+    struct stat info;
+    if(stat(pPath, &info) == 0 && S_ISSOCK(info.st_mode))
+    {
+        unlink(pPath);
+    }
+}
+
+// Return the listening socket, -1 if it cannot be opened
+static int OpenServer(const char * pPath)
+{
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if(strlen(pPath) >= sizeof(address.sun_path))
+    {
+        return -1;
+    }
+    strcpy(address.sun_path, pPath);
+    RemoveSocketFile(pPath);
+
+    const int LISTENER = MakeNonBlocking(socket(AF_UNIX, SOCK_STREAM, 0));
+    if(LISTENER >= 0 && (bind(LISTENER, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(LISTENER, MAX_SPECTATORS) != 0))
+    {
+        close(LISTENER);
+        return -1;
+    }
+    return LISTENER;
+}
+
+// Return the next waiting spectator, -1 if there is none
+static int AcceptSpectator(void)
+{
+    return MakeNonBlocking(accept(serverSocket, NULL, NULL));
+}
+
+// Return the number of bytes sent, 0 if the socket is full, -1 on error
+static int SendSome(const int socket, const uchar * pData, const uint size)
+{
+    const ssize_t SENT = send(socket, pData, size, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if(SENT < 0)
+    {
+        return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+    }
+    return (int)SENT;
+}
+
+// Return TRUE if the spectator has hung up
+// Anything a spectator sends is ignored
+static BOOL IsClosed(const int socket)
+{
+    uchar buffer[64];
+    const ssize_t RECEIVED = recv(socket, buffer, sizeof(buffer), MSG_DONTWAIT);
+    return RECEIVED == 0 || (RECEIVED < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+}
+
+static void CloseSocket(const int socket)
+{
+    close(socket);
+}
+#endif // _WIN32
+
+// Little endian writers, return the position after the value
+static inline uchar * PutU8(uchar * p, const uint value)
+{
+    *p++ = (uchar)value;
+    return p;
+}
+
+static inline uchar * PutU16(uchar * p, const uint value)
+{
+    *p++ = (uchar)value;
+    *p++ = (uchar)(value >> 8);
+    return p;
+}
+
+static inline uchar * PutU32(uchar * p, const uint value)
+{
+    *p++ = (uchar)value;
+    *p++ = (uchar)(value >> 8);
+    *p++ = (uchar)(value >> 16);
+    *p++ = (uchar)(value >> 24);
+    return p;
+}
+
+static inline uchar * PutPoint(uchar * p, const Point point)
+{
+    return PutU16(PutU16(p, (uint)point.x), (uint)point.y);
+}
+
+// Write the message header in front of a payload that ends at pEnd
+// Return the message size
+static uint FinishMessage(uchar * pMessage, const SpectatorMessage type, const uchar * pEnd)
+{
+    const uint SIZE = (uint)(pEnd - pMessage);
+    PutU32(PutU8(pMessage, type), SIZE - SPECTATOR_HEADER_SIZE);
+    return SIZE;
+}
+
+// Return the mirrored body point, 0 being the head
+static inline Point BodyAt(const uint i)
+{
+    return pBodyArr[(headPos + i) % bodySize];
+}
+
+// Encode the mirrored state as a keyframe
+// Return the message size
+static uint EncodeKeyframe(void)
+{
+    uchar * p = pKeyframe + SPECTATOR_HEADER_SIZE;
+    p = PutU32(p, gameId);
+    p = PutU32(p, tickCount);
+    p = PutU32(p, score);
+    p = PutU8(p, result);
+    p = PutU16(p, width);
+    p = PutU16(p, height);
+    p = PutPoint(p, food);
+    p = PutU32(p, length);
+    for(uint i = 0; i < length; i++)
+    {
+        p = PutPoint(p, BodyAt(i));
+    }
+    return FinishMessage(pKeyframe, cSpectatorKeyframe, p);
+}
+
+// Disconnect the spectator and print how much it was sent
+static void Drop(Spectator * pSpectator, const char * pReason)
+{
+    const double SECONDS = (double)(SDL_GetPerformanceCounter() - pSpectator->connectTime) / (double)SDL_GetPerformanceFrequency();
+    printf("Spectator %s: %llu bytes in %.1f s, %.0f bytes/s\n", pReason, pSpectator->byteCount, SECONDS,
+           (SECONDS > 0.0) ? pSpectator->byteCount / SECONDS : 0.0);
+    CloseSocket(pSpectator->socket);
+    pSpectator->socket = -1;
+}
+
+// Send as much of the queue as the socket takes
+static void Flush(Spectator * pSpectator)
+{
+    while(pSpectator->start < pSpectator->end)
+    {
+        const int SENT = SendSome(pSpectator->socket, pSpectator->pQueue + pSpectator->start, pSpectator->end - pSpectator->start);
+        if(SENT < 0)
+        {
+            Drop(pSpectator, "disconnected");
+            return;
+        }
+        if(SENT == 0)
+        {
+            return;
+        }
+        pSpectator->start     += (uint)SENT;
+        pSpectator->byteCount += (uint)SENT;
+        totalByteCount        += (uint)SENT;
+    }
+    pSpectator->start = 0;
+    pSpectator->end   = 0;
+}
+
+// Queue the message and try to send it right away
+// A spectator that cannot keep up is dropped instead of waited for
+static void Send(Spectator * pSpectator, const uchar * pMessage, const uint size)
+{
+    if(pSpectator->end + size > queueSize)
+    {
+        memmove(pSpectator->pQueue, pSpectator->pQueue + pSpectator->start, pSpectator->end - pSpectator->start);
+        pSpectator->end  -= pSpectator->start;
+        pSpectator->start = 0;
+    }
+    if(pSpectator->end + size > queueSize)
+    {
+        Drop(pSpectator, "too slow");
+        droppedCount++;
+        return;
+    }
+    memcpy(pSpectator->pQueue + pSpectator->end, pMessage, size);
+    pSpectator->end += size;
+    Flush(pSpectator);
+}
+
+// Send the message to every spectator
+static void Broadcast(const uchar * pMessage, const uint size)
+{
+    for(int i = 0; i < MAX_SPECTATORS; i++)
+    {
+        if(spectatorArr[i].socket >= 0)
+        {
+            Send(&spectatorArr[i], pMessage, size);
+        }
+    }
+}
+
+// Copy the snapshot into the mirror
+static void Mirror(const Snapshot * pSnapshot)
+{
+    gameId    = pSnapshot->gameId;
+    tickCount = pSnapshot->tickCount;
+    score     = pSnapshot->score;
+    result    = (uchar)pSnapshot->result;
+    width     = pSnapshot->width;
+    height    = pSnapshot->height;
+    food      = pSnapshot->food;
+    headPos   = 0;
+    length    = (pSnapshot->length < bodySize) ? pSnapshot->length : bodySize;
+    memcpy(pBodyArr, pSnapshot->pBodyArr, length * sizeof(Point));
+    hasState  = TRUE;
+}
+
+// Apply a single move of the snapshot to the mirrored body
+// Return the number of tail points removed, -1 if the snapshot is not one move on
+static int MirrorMove(const Snapshot * pSnapshot)
+{
+    if(pSnapshot->tickCount != tickCount + 1 || pSnapshot->length == 0 || pSnapshot->length > length + 1)
+    {
+        return -1;
+    }
+    const uint REMOVED = length + 1 - pSnapshot->length;
+    headPos = (headPos + bodySize - 1) % bodySize;
+    pBodyArr[headPos] = pSnapshot->pBodyArr[0];
+    length = pSnapshot->length;
+    if(REMOVED > 255 || !PointsAreEqual(BodyAt(length - 1), pSnapshot->pBodyArr[length - 1]))
+    {
+        return -1;
+    }
+    return (int)REMOVED;
+}
+
+// Public functions
+
+// "Constructor"
+// Start listening on the socket at pPath for a board of the given size
+// Must be called before the simulation thread is started
+// Return FALSE if the socket cannot be opened
+BOOL SpectatorInitialise(const char * pPath, const ushort boardWidth, const ushort boardHeight)
+{
+    SpectatorFree();
+    for(int i = 0; i < MAX_SPECTATORS; i++)
+    {
+        spectatorArr[i].socket = -1;
+    }
+    bodySize  = ((uint)boardWidth * boardHeight) + 1;
+    queueSize = KEYFRAME_SIZE + (bodySize * 4) + BACKLOG_SIZE;
+    pBodyArr  = (Point *)calloc(bodySize, sizeof(Point));
+    pKeyframe = (uchar *)malloc(KEYFRAME_SIZE + (bodySize * 4));
+    BOOL isAllocated = (pBodyArr && pKeyframe);
+    for(int i = 0; i < MAX_SPECTATORS && isAllocated; i++)
+    {
+        spectatorArr[i].pQueue = (uchar *)malloc(queueSize);
+        isAllocated = (spectatorArr[i].pQueue != NULL);
+    }
+    if(isAllocated && strlen(pPath) < sizeof(socketPath))
+    {
+        serverSocket = OpenServer(pPath);
+    }
+    if(serverSocket < 0)
+    {
+        SpectatorFree();
+        return FALSE;
+    }
+    strcpy(socketPath, pPath);
+    return TRUE;
+}
+
+// "Destructor"
+// Disconnect every spectator and remove the socket
+void SpectatorFree(void)
+{
+    for(int i = 0; i < MAX_SPECTATORS; i++)
+    {
+        if(spectatorArr[i].pQueue && spectatorArr[i].socket >= 0)
+        {
+            Drop(&spectatorArr[i], "closed");
+        }
+        free(spectatorArr[i].pQueue);
+        spectatorArr[i].pQueue = NULL;
+    }
+    if(serverSocket >= 0)
+    {
+        CloseSocket(serverSocket);
+        RemoveSocketFile(socketPath);
+        serverSocket = -1;
+        printf("Spectators: %u served, %u dropped for being too slow, %llu bytes sent\n",
+               spectatorCount, droppedCount, totalByteCount);
+    }
+    free(pBodyArr);
+    free(pKeyframe);
+    pBodyArr       = NULL;
+    pKeyframe      = NULL;
+    hasState       = FALSE;
+    spectatorCount = 0;
+    droppedCount   = 0;
+    totalByteCount = 0;
+}
+
+// Send the changes since the last published snapshot to every spectator
+// Anything that is not a single move (a new game, a grown snake)
+// is sent as a keyframe instead
+// Called by the simulation runner
+void SpectatorPublish(const Snapshot * pSnapshot)
+{
+    if(serverSocket < 0)
+    {
+        return;
+    }
+    if(!hasState || pSnapshot->gameId != gameId || pSnapshot->width != width || pSnapshot->height != height)
+    {
+        Mirror(pSnapshot);
+        Broadcast(pKeyframe, EncodeKeyframe());
+        return;
+    }
+
+    uchar message[DELTA_MAX_SIZE];
+    uchar * p = message + SPECTATOR_HEADER_SIZE + 5;  // After the tick and flags
+    uchar flags = 0;
+    if(pSnapshot->length > 0 && !PointsAreEqual(pSnapshot->pBodyArr[0], BodyAt(0)))
+    {
+        const int REMOVED = MirrorMove(pSnapshot);
+        if(REMOVED < 0)
+        {
+            Mirror(pSnapshot);
+            Broadcast(pKeyframe, EncodeKeyframe());
+            return;
+        }
+        p = PutU8(PutPoint(p, BodyAt(0)), (uint)REMOVED);
+        flags |= SPECTATOR_DELTA_MOVED;
+    }
+    else if(pSnapshot->length != length)
+    {
+        Mirror(pSnapshot);
+        Broadcast(pKeyframe, EncodeKeyframe());
+        return;
+    }
+    if(!PointsAreEqual(pSnapshot->food, food))
+    {
+        food = pSnapshot->food;
+        p = PutPoint(p, food);
+        flags |= SPECTATOR_DELTA_FOOD;
+    }
+    if(pSnapshot->score != score)
+    {
+        score = pSnapshot->score;
+        p = PutU32(p, score);
+        flags |= SPECTATOR_DELTA_SCORE;
+    }
+    if((uchar)pSnapshot->result != result)
+    {
+        result = (uchar)pSnapshot->result;
+        p = PutU8(p, result);
+        flags |= SPECTATOR_DELTA_RESULT;
+    }
+    if(flags == 0 && pSnapshot->tickCount == tickCount)
+    {
+        return;
+    }
+    tickCount = pSnapshot->tickCount;
+    PutU8(PutU32(message + SPECTATOR_HEADER_SIZE, tickCount), flags);
+    Broadcast(message, FinishMessage(message, cSpectatorDelta, p));
+}
+
+// Accept new spectators, send them a keyframe, and retry queued sends
+// Does nothing until POLL_INTERVAL has passed since the last check
+// Called by the simulation runner
+// Return the milliseconds until the next check, -1 if not serving
+int SpectatorUpdate(void)
+{
+    if(serverSocket < 0)
+    {
+        return -1;
+    }
+    const Uint32 NOW = SDL_GetTicks();
+    if((Sint32)(nextPollTime - NOW) > 0)
+    {
+        return (int)(nextPollTime - NOW);
+    }
+    nextPollTime = NOW + POLL_INTERVAL;
+
+    for(int i = 0; i < MAX_SPECTATORS; i++)
+    {
+        Spectator * pSpectator = &spectatorArr[i];
+        if(pSpectator->socket >= 0 && IsClosed(pSpectator->socket))
+        {
+            Drop(pSpectator, "disconnected");
+        }
+        else if(pSpectator->socket >= 0)
+        {
+            Flush(pSpectator);
+        }
+        if(pSpectator->socket >= 0)
+        {
+            continue;
+        }
+
+        // Spectators past MAX_SPECTATORS wait in the listen backlog
+        pSpectator->socket = AcceptSpectator();
+        if(pSpectator->socket < 0)
+        {
+            continue;
+        }
+        pSpectator->start       = 0;
+        pSpectator->end         = 0;
+        pSpectator->byteCount   = 0;
+        pSpectator->connectTime = SDL_GetPerformanceCounter();
+        spectatorCount++;
+        if(hasState)
+        {
+            Send(pSpectator, pKeyframe, EncodeKeyframe());
+        }
+    }
+    return POLL_INTERVAL;
+}
+
+// Return TRUE if the socket is open
+BOOL SpectatorIsServing(void)
+{
+    return serverSocket >= 0;
+}
@@ -0,0 +1,48 @@
+#ifndef SPECTATOR_H
+#define SPECTATOR_H
+
+#include "types.h"
+#include "snapshot.h"
+
+// Local spectator server
+//
+// Serves the game on a Unix domain socket. A spectator receives a keyframe
+// with the whole state when it connects, then one delta per published
+// snapshot: head added, tail points removed, food moved, score and result.
+// The server is driven by the simulation runner and never blocks it:
+// sockets are non-blocking, every spectator has a bounded send queue, and
+// a spectator whose queue overflows is disconnected. Not available on Windows.
+//
+// Every message is a uint8 SpectatorMessage, a uint32 payload size, then
+// the payload. All values are little endian, points are two uint16.
+//   Keyframe: uint32 gameId, tick, score; uint8 result; uint16 width, height;
+//             point food; uint32 length; 'length' points from head to tail
+//   Delta:    uint32 tick; uint8 flags (SPECTATOR_DELTA_*), then in this order
+//             MOVED:  point head, uint8 tail points removed
+//             FOOD:   point food
+//             SCORE:  uint32 score
+//             RESULT: uint8 result
+// Right after eating the tail point is doubled up, like in Snapshot::pBodyArr,
+// so a move can remove zero, one or two points
+typedef enum
+{
+    cSpectatorKeyframe = 0,
+    cSpectatorDelta    = 1,
+} SpectatorMessage;
+
+#define SPECTATOR_HEADER_SIZE 5
+#define SPECTATOR_DELTA_MOVED  0x1
+#define SPECTATOR_DELTA_FOOD   0x2
+#define SPECTATOR_DELTA_SCORE  0x4
+#define SPECTATOR_DELTA_RESULT 0x8
+
+// Main functions
+BOOL SpectatorInitialise(const char * pPath, const ushort width, const ushort height);
+void SpectatorFree(void);
+void SpectatorPublish(const Snapshot * pSnapshot);
+int SpectatorUpdate(void);
+
+// Helper functions
+BOOL SpectatorIsServing(void);
+
+#endif // !SPECTATOR_H
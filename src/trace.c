@@ -0,0 +1,153 @@
+#include "trace.h"
+
+// Compiled only with -DTRACE
+#ifdef TRACE
+#include <stdio.h>
+#include <stdlib.h>
+
+// Zones kept per thread, later zones are dropped
+#define BUFFER_CAPACITY (1 << 18)
+
+// Number of threads that can record zones
+#define MAX_THREADS 8
+
+typedef struct
+{
+    const char * pName;
+    Uint64       start;
+    Uint64       end;
+} TraceEvent;
+
+// Only the owning thread writes to a buffer; the exporter
+// reads the first 'count' events, which are never changed again
+typedef struct
+{
+    TraceEvent * pEventArr;
+    SDL_atomic_t count;
+    SDL_threadID threadId;
+} TraceBuffer;
+
+// Internal variables for the buffers
+static TraceBuffer  bufferArr[MAX_THREADS];
+static SDL_atomic_t bufferCount;
+static SDL_atomic_t droppedCount;
+static Uint64       startTime;
+
+// Buffer of the calling thread, NULL until its first zone
+static __thread TraceBuffer * pThreadBuffer;
+static __thread BOOL          hasNoBuffer;
+
+// Internal functions
+
+// Claim a buffer for the calling thread
+// Return NULL if all buffers are taken or out of memory
+static TraceBuffer * CreateBuffer(void)
+{
+    const int SLOT = SDL_AtomicAdd(&bufferCount, 1);
+    if(SLOT >= MAX_THREADS)
+    {
+        return NULL;
+    }
+    TraceBuffer * pBuffer = &bufferArr[SLOT];
+    pBuffer->pEventArr = (TraceEvent *)malloc(BUFFER_CAPACITY * sizeof(TraceEvent));
+    pBuffer->threadId  = SDL_ThreadID();
+    return (pBuffer->pEventArr) ? pBuffer : NULL;
+}
+
+// Public functions
+
+// "Constructor"
+// Start the trace clock
+void TraceInitialise(void)
+{
+    startTime = SDL_GetPerformanceCounter();
+}
+
+// "Destructor"
+// Free the buffers
+// No thread may record zones anymore
+void TraceFree(void)
+{
+    const int COUNT = SDL_AtomicGet(&bufferCount);
+    for(int i = 0; i < COUNT && i < MAX_THREADS; i++)
+    {
+        free(bufferArr[i].pEventArr);
+        bufferArr[i].pEventArr = NULL;
+        SDL_AtomicSet(&bufferArr[i].count, 0);
+    }
+    SDL_AtomicSet(&bufferCount, 0);
+    if(SDL_AtomicGet(&droppedCount) > 0)
+    {
+        printf("Trace dropped %d zones\n", SDL_AtomicGet(&droppedCount));
+    }
+}
+
+// Record a zone that started at 'start' and ends now
+// pName must stay valid until the trace is exported
+void TraceZone(const char * pName, const Uint64 start)
+{
+    const Uint64 END = SDL_GetPerformanceCounter();
+    if(!pThreadBuffer)
+    {
+        if(hasNoBuffer)
+        {
+            return;
+        }
+        pThreadBuffer = CreateBuffer();
+        hasNoBuffer = (pThreadBuffer == NULL);
+        if(hasNoBuffer)
+        {
+            return;
+        }
+    }
+
+    const int COUNT = SDL_AtomicGet(&pThreadBuffer->count);
+    if(COUNT == BUFFER_CAPACITY)
+    {
+        SDL_AtomicAdd(&droppedCount, 1);
+        return;
+    }
+    TraceEvent * pEvent = &pThreadBuffer->pEventArr[COUNT];
+    pEvent->pName = pName;
+    pEvent->start = start;
+    pEvent->end   = END;
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&pThreadBuffer->count, COUNT + 1);
+}
+
+// Write every zone recorded so far as Chrome trace-event JSON
+// Can be called while other threads are recording
+// Return FALSE if the file cannot be written
+BOOL TraceExport(const char * pPath)
+{
+    FILE * pFile = fopen(pPath, "w");
+    if(!pFile)
+    {
+        return FALSE;
+    }
+
+    const double TO_MICROSECONDS = 1000000.0 / (double)SDL_GetPerformanceFrequency();
+    const int BUFFER_COUNT = SDL_AtomicGet(&bufferCount);
+    BOOL isFirst = TRUE;
+    fprintf(pFile, "{\"traceEvents\":[\n");
+    for(int i = 0; i < BUFFER_COUNT && i < MAX_THREADS; i++)
+    {
+        const TraceBuffer * pBuffer = &bufferArr[i];
+        const int COUNT = SDL_AtomicGet((SDL_atomic_t *)&pBuffer->count);
+        SDL_MemoryBarrierAcquire();
+        for(int e = 0; e < COUNT; e++)
+        {
+            const TraceEvent * pEvent = &pBuffer->pEventArr[e];
+            fprintf(pFile, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f}",
+                    isFirst ? "" : ",\n", pEvent->pName, (unsigned long)pBuffer->threadId,
+                    (double)(pEvent->start - startTime) * TO_MICROSECONDS,
+                    (double)(pEvent->end - pEvent->start) * TO_MICROSECONDS);
+            isFirst = FALSE;
+        }
+    }
+    fprintf(pFile, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    const BOOL IS_WRITTEN = !ferror(pFile);
+    fclose(pFile);
+    return IS_WRITTEN;
+}
+#endif // TRACE
@@ -0,0 +1,35 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "types.h"
+
+// Trace zones
+//
+// Build with -DTRACE to time the zones marked with TRACE_BEGIN()/TRACE_END()
+// and export them as Chrome trace-event JSON, which can be loaded in Perfetto
+// or chrome://tracing. Every thread records into its own buffer, so zones
+// need no locks. Without TRACE the macros compile to nothing.
+//
+// Zones must be closed on every path out of the scope they were opened in
+#ifdef TRACE
+#include <SDL2/SDL.h>
+
+#define TRACE_BEGIN(zone) const Uint64 traceStart_##zone = SDL_GetPerformanceCounter()
+#define TRACE_END(zone)   TraceZone(#zone, traceStart_##zone)
+
+// File written on exit and by the trace hotkey
+#define TRACE_FILE "trace.json"
+
+// Main functions
+void TraceInitialise(void);
+void TraceFree(void);
+
+// Helper functions
+void TraceZone(const char * pName, const Uint64 start);
+BOOL TraceExport(const char * pPath);
+#else
+#define TRACE_BEGIN(zone)
+#define TRACE_END(zone)
+#endif // TRACE
+
+#endif // !TRACE_H
@@ -16,6 +16,16 @@ typedef unsigned char uchar;
 typedef unsigned short ushort;
 typedef unsigned int uint;
 
+// Storage of the engine state (board, snake, simulation, observation
+// and space modules). Build with ENGINE_THREAD_LOCAL to give every thread
+// its own game, as snake-bench and the library do. The game itself only
+// ever runs one engine
+#ifdef ENGINE_THREAD_LOCAL
+#define ENGINE_STATE static __thread
+#else
+#define ENGINE_STATE static
+#endif // ENGINE_THREAD_LOCAL
+
 // Shared enums
 
 // Game-state enum
@@ -0,0 +1,194 @@
+// Font atlas generator
+//
+// Rasterises the printable ASCII characters of a TrueType font into a
+// one bit per pixel atlas and writes it, the glyph metrics and the font
+// file itself as a C header (see src/glyphatlas.h).
+// Glyphs are rendered the way SDL_ttf renders solid text: monochrome,
+// with FreeType's default hinting, at 72 dpi.
+//
+// Usage: fontatlas <font.ttf> <point size> <output.h>
+// Build: gcc tools/fontatlas.c `pkg-config --cflags --libs freetype2` -o fontatlas
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#define FIRST_CHAR  32
+#define LAST_CHAR   126
+#define CHAR_COUNT  (LAST_CHAR - FIRST_CHAR + 1)
+#define ATLAS_WIDTH 256  // Multiple of 8
+#define GLYPH_GAP   1    // Empty pixels between glyphs
+
+typedef struct
+{
+    int x;
+    int y;
+    int w;
+    int h;
+    int left;
+    int top;
+    int advance;
+} Glyph;
+
+// Round 26.6 fixed point up to whole pixels, like SDL_ttf
+static int Ceil26(const FT_Long value)
+{
+    return (int)(((value + 63) & -64) / 64);
+}
+
+// Return the contents of a file, or NULL
+static unsigned char * ReadFile(const char * pPath, long * pSize)
+{
+    FILE * pFile = fopen(pPath, "rb");
+    if(!pFile)
+    {
+        return NULL;
+    }
+    fseek(pFile, 0, SEEK_END);
+    *pSize = ftell(pFile);
+    fseek(pFile, 0, SEEK_SET);
+    unsigned char * pData = (unsigned char *)malloc(*pSize);
+    if(pData && fread(pData, 1, *pSize, pFile) != (size_t)*pSize)
+    {
+        free(pData);
+        pData = NULL;
+    }
+    fclose(pFile);
+    return pData;
+}
+
+// Write a byte array, 16 values per line
+static void WriteBytes(FILE * pOut, const char * pName, const unsigned char * pData, const long size)
+{
+    fprintf(pOut, "static const uchar %s[%ld] =\n{\n", pName, size);
+    for(long i = 0; i < size; i++)
+    {
+        fprintf(pOut, "%s0x%02x,%s", (i % 16 == 0) ? "    " : "", pData[i], (i % 16 == 15 || i == size - 1) ? "\n" : " ");
+    }
+    fprintf(pOut, "};\n\n");
+}
+
+int main(int argc, char * argv[])
+{
+    if(argc != 4)
+    {
+        printf("Usage: %s <font.ttf> <point size> <output.h>\n", argv[0]);
+        return 1;
+    }
+    const int POINT_SIZE = atoi(argv[2]);
+
+    long fontSize = 0;
+    unsigned char * pFontData = ReadFile(argv[1], &fontSize);
+    if(!pFontData)
+    {
+        printf("Cannot read %s\n", argv[1]);
+        return 1;
+    }
+
+    FT_Library library;
+    FT_Face face;
+    if(FT_Init_FreeType(&library) != 0
+    || FT_New_Memory_Face(library, pFontData, fontSize, 0, &face) != 0
+    || FT_Set_Char_Size(face, 0, POINT_SIZE * 64, 0, 0) != 0)
+    {
+        printf("Cannot load %s\n", argv[1]);
+        return 1;
+    }
+    if(FT_HAS_KERNING(face))
+    {
+        printf("Warning: kerning is not stored in the atlas\n");
+    }
+
+    // Same vertical metrics as TTF_FontAscent() and TTF_FontHeight()
+    const FT_Fixed SCALE = face->size->metrics.y_scale;
+    const int ASCENT = Ceil26(FT_MulFix(face->ascender, SCALE));
+    const int HEIGHT = Ceil26(FT_MulFix(face->ascender - face->descender, SCALE));
+
+    // Place the glyphs on shelves, left to right
+    Glyph glyphArr[CHAR_COUNT];
+    unsigned char * pBits = (unsigned char *)calloc(ATLAS_WIDTH / 8, HEIGHT * CHAR_COUNT);
+    int x = 0;
+    int y = 0;
+    int shelfHeight = 0;
+    for(int c = FIRST_CHAR; c <= LAST_CHAR; c++)
+    {
+        if(FT_Load_Char(face, c, FT_LOAD_RENDER | FT_LOAD_TARGET_MONO) != 0)
+        {
+            printf("Cannot render character %d\n", c);
+            return 1;
+        }
+        const FT_GlyphSlot SLOT = face->glyph;
+        const FT_Bitmap * pBitmap = &SLOT->bitmap;
+        Glyph * pGlyph = &glyphArr[c - FIRST_CHAR];
+        if(x + (int)pBitmap->width > ATLAS_WIDTH)
+        {
+            x = 0;
+            y += shelfHeight + GLYPH_GAP;
+            shelfHeight = 0;
+        }
+        pGlyph->x       = x;
+        pGlyph->y       = y;
+        pGlyph->w       = (int)pBitmap->width;
+        pGlyph->h       = (int)pBitmap->rows;
+        pGlyph->left    = SLOT->bitmap_left;
+        pGlyph->top     = SLOT->bitmap_top;
+        pGlyph->advance = (int)(SLOT->advance.x / 64);
+
+        for(int row = 0; row < pGlyph->h; row++)
+        {
+            for(int col = 0; col < pGlyph->w; col++)
+            {
+                if(pBitmap->buffer[(row * pBitmap->pitch) + (col / 8)] & (0x80 >> (col % 8)))
+                {
+                    const int PX = x + col;
+                    pBits[((y + row) * (ATLAS_WIDTH / 8)) + (PX / 8)] |= (unsigned char)(0x80 >> (PX % 8));
+                }
+            }
+        }
+        x += pGlyph->w + GLYPH_GAP;
+        shelfHeight = (pGlyph->h > shelfHeight) ? pGlyph->h : shelfHeight;
+    }
+    const int ATLAS_HEIGHT = y + shelfHeight;
+
+    FILE * pOut = fopen(argv[3], "w");
+    if(!pOut)
+    {
+        printf("Cannot write %s\n", argv[3]);
+        return 1;
+    }
+    fprintf(pOut, "// Generated by tools/fontatlas.c from %s at %d points - do not edit\n", argv[1], POINT_SIZE);
+    fprintf(pOut, "// Regenerate with 'make -f makefile_unix font_atlas'\n\n");
+    fprintf(pOut, "#ifndef FONTDATA_H\n#define FONTDATA_H\n\n#include \"types.h\"\n\n");
+    fprintf(pOut, "#define FONT_POINT_SIZE   %d\n", POINT_SIZE);
+    fprintf(pOut, "#define FONT_ASCENT       %d\n", ASCENT);
+    fprintf(pOut, "#define FONT_HEIGHT       %d\n", HEIGHT);
+    fprintf(pOut, "#define FONT_FIRST_CHAR   %d\n", FIRST_CHAR);
+    fprintf(pOut, "#define FONT_LAST_CHAR    %d\n", LAST_CHAR);
+    fprintf(pOut, "#define FONT_ATLAS_WIDTH  %d\n", ATLAS_WIDTH);
+    fprintf(pOut, "#define FONT_ATLAS_HEIGHT %d\n\n", ATLAS_HEIGHT);
+    fprintf(pOut, "// Atlas rectangle, offset from the pen position on the baseline, and advance\n");
+    fprintf(pOut, "typedef struct\n{\n    ushort x;\n    ushort y;\n    uchar  w;\n    uchar  h;\n    short  left;\n    short  top;\n    uchar  advance;\n} FontGlyph;\n\n");
+    fprintf(pOut, "static const FontGlyph FONT_GLYPH_ARR[%d] =\n{\n", CHAR_COUNT);
+    for(int i = 0; i < CHAR_COUNT; i++)
+    {
+        const Glyph * pGlyph = &glyphArr[i];
+        fprintf(pOut, "    { %3d, %3d, %2d, %2d, %2d, %2d, %2d }, // '%c'\n", pGlyph->x, pGlyph->y, pGlyph->w, pGlyph->h, pGlyph->left, pGlyph->top, pGlyph->advance, FIRST_CHAR + i);
+    }
+    fprintf(pOut, "};\n\n");
+    fprintf(pOut, "// One bit per pixel, %d bytes per row, leftmost pixel in the highest bit\n", ATLAS_WIDTH / 8);
+    WriteBytes(pOut, "FONT_ATLAS_BITS", pBits, (long)(ATLAS_WIDTH / 8) * ATLAS_HEIGHT);
+    fprintf(pOut, "// The font file, for text the atlas cannot draw\n");
+    WriteBytes(pOut, "FONT_TTF_DATA", pFontData, fontSize);
+    fprintf(pOut, "#endif // !FONTDATA_H\n");
+    fclose(pOut);
+
+    printf("%s: %dx%d atlas, %d glyphs, %ld byte font\n", argv[3], ATLAS_WIDTH, ATLAS_HEIGHT, CHAR_COUNT, fontSize);
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    free(pBits);
+    free(pFontData);
+    return 0;
+}
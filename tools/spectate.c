@@ -0,0 +1,295 @@
+// Spectator test client
+//
+// Connects to a game started with --spectate, applies the keyframes and
+// deltas to its own copy of the state (see src/spectator.h), and prints
+// every keyframe, the game results and the bandwidth once a second.
+// With --draw, the board is printed after every message.
+// With --slow, the client sleeps after every read, so the game drops it.
+//
+// Usage: spectate <socket> [--draw] [--slow <ms>]
+// Build: gcc -std=c99 tools/spectate.c -o spectate
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../src/spectator.h"
+
+typedef struct
+{
+    unsigned short x;
+    unsigned short y;
+} Cell;
+
+// Mirrored state, the body is a ring with the head at headPos
+static unsigned gameId;
+static unsigned tickCount;
+static unsigned score;
+static unsigned result;
+static unsigned width;
+static unsigned height;
+static Cell     food;
+static Cell *   pBodyArr;
+static unsigned bodySize;
+static unsigned headPos;
+static unsigned length;
+
+static unsigned GetU16(const unsigned char * p)
+{
+    return (unsigned)p[0] | ((unsigned)p[1] << 8);
+}
+
+static unsigned GetU32(const unsigned char * p)
+{
+    return GetU16(p) | (GetU16(p + 2) << 16);
+}
+
+static Cell GetCell(const unsigned char * p)
+{
+    Cell cell;
+    cell.x = (unsigned short)GetU16(p);
+    cell.y = (unsigned short)GetU16(p + 2);
+    return cell;
+}
+
+static double Now(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + (time.tv_nsec / 1e9);
+}
+
+// Read exactly 'size' bytes, return 0 when the game has gone
+static int ReadAll(const int socket, unsigned char * pData, const size_t size)
+{
+    size_t done = 0;
+    while(done < size)
+    {
+        const ssize_t RECEIVED = recv(socket, pData + done, size - done, 0);
+        if(RECEIVED <= 0)
+        {
+            return 0;
+        }
+        done += (size_t)RECEIVED;
+    }
+    return 1;
+}
+
+// Return 0 if the keyframe is malformed
+static int ApplyKeyframe(const unsigned char * p, const unsigned size)
+{
+    if(size < 25)
+    {
+        return 0;
+    }
+    gameId    = GetU32(p);
+    tickCount = GetU32(p + 4);
+    score     = GetU32(p + 8);
+    result    = p[12];
+    width     = GetU16(p + 13);
+    height    = GetU16(p + 15);
+    food      = GetCell(p + 17);
+    length    = GetU32(p + 21);
+    if(size != 25 + (length * 4))
+    {
+        return 0;
+    }
+    if(bodySize < (width * height) + 2 || bodySize < length)
+    {
+        bodySize = ((width * height) + 2 > length) ? (width * height) + 2 : length;
+        free(pBodyArr);
+        pBodyArr = (Cell *)malloc(bodySize * sizeof(Cell));
+        if(!pBodyArr)
+        {
+            return 0;
+        }
+    }
+    headPos = 0;
+    for(unsigned i = 0; i < length; i++)
+    {
+        pBodyArr[i] = GetCell(p + 25 + (i * 4));
+    }
+    printf("keyframe: game %u tick %u score %u length %u board %ux%u\n", gameId, tickCount, score, length, width, height);
+    return 1;
+}
+
+// Return 0 if the delta is malformed
+static int ApplyDelta(const unsigned char * p, const unsigned size)
+{
+    if(size < 5 || !pBodyArr)
+    {
+        return 0;
+    }
+    tickCount = GetU32(p);
+    const unsigned FLAGS = p[4];
+    const unsigned EXPECTED = 5 + ((FLAGS & SPECTATOR_DELTA_MOVED) ? 5 : 0) + ((FLAGS & SPECTATOR_DELTA_FOOD) ? 4 : 0)
+                            + ((FLAGS & SPECTATOR_DELTA_SCORE) ? 4 : 0) + ((FLAGS & SPECTATOR_DELTA_RESULT) ? 1 : 0);
+    if(size != EXPECTED)
+    {
+        return 0;
+    }
+    p += 5;
+    if(FLAGS & SPECTATOR_DELTA_MOVED)
+    {
+        if(length + 1 < p[4] || length + 1 > bodySize)
+        {
+            return 0;
+        }
+        headPos = (headPos + bodySize - 1) % bodySize;
+        pBodyArr[headPos] = GetCell(p);
+        length = length + 1 - p[4];
+        p += 5;
+    }
+    if(FLAGS & SPECTATOR_DELTA_FOOD)
+    {
+        food = GetCell(p);
+        p += 4;
+    }
+    if(FLAGS & SPECTATOR_DELTA_SCORE)
+    {
+        score = GetU32(p);
+        p += 4;
+    }
+    if(FLAGS & SPECTATOR_DELTA_RESULT)
+    {
+        result = *p++;
+        if(result == cTickDefeat || result == cTickVictory)
+        {
+            printf("game %u: %s at tick %u, score %u\n", gameId, (result == cTickVictory) ? "victory" : "defeat", tickCount, score);
+        }
+    }
+    return 1;
+}
+
+static void Draw(void)
+{
+    char * pBoard = (char *)malloc(width * height);
+    if(!pBoard)
+    {
+        return;
+    }
+    memset(pBoard, '.', width * height);
+    if(food.x < width && food.y < height)
+    {
+        pBoard[(food.y * width) + food.x] = '*';
+    }
+    for(unsigned i = length; i-- > 0;)
+    {
+        const Cell CELL = pBodyArr[(headPos + i) % bodySize];
+        if(CELL.x < width && CELL.y < height)
+        {
+            pBoard[(CELL.y * width) + CELL.x] = (i == 0) ? '@' : 'o';
+        }
+    }
+    printf("\ntick %u score %u\n", tickCount, score);
+    for(unsigned y = 0; y < height; y++)
+    {
+        printf("%.*s\n", (int)width, &pBoard[y * width]);
+    }
+    free(pBoard);
+}
+
+int main(int argc, char * argv[])
+{
+    if(argc < 2)
+    {
+        printf("Usage: spectate <socket> [--draw] [--slow <ms>]\n");
+        return 1;
+    }
+    int isDrawing = 0;
+    long slowMs = 0;
+    for(int i = 2; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--draw") == 0)
+        {
+            isDrawing = 1;
+        }
+        else if(strcmp(argv[i], "--slow") == 0 && i + 1 < argc)
+        {
+            slowMs = strtol(argv[++i], NULL, 10);
+        }
+    }
+
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, argv[1], sizeof(address.sun_path) - 1);
+    const int SOCKET = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(SOCKET < 0 || connect(SOCKET, (struct sockaddr *)&address, sizeof(address)) != 0)
+    {
+        printf("Cannot connect to %s\n", argv[1]);
+        return 1;
+    }
+
+    unsigned char * pPayload = NULL;
+    unsigned payloadSize = 0;
+    unsigned long long byteCount = 0;
+    unsigned long long intervalBytes = 0;
+    unsigned messageCount = 0;
+    const double START = Now();
+    double intervalStart = START;
+    unsigned char header[SPECTATOR_HEADER_SIZE];
+    while(ReadAll(SOCKET, header, sizeof(header)))
+    {
+        const unsigned SIZE = GetU32(header + 1);
+        if(SIZE > payloadSize)
+        {
+            free(pPayload);
+            payloadSize = SIZE;
+            pPayload = (unsigned char *)malloc(payloadSize);
+            if(!pPayload)
+            {
+                break;
+            }
+        }
+        if(!ReadAll(SOCKET, pPayload, SIZE))
+        {
+            break;
+        }
+        const int IS_VALID = (header[0] == cSpectatorKeyframe) ? ApplyKeyframe(pPayload, SIZE)
+                           : (header[0] == cSpectatorDelta)    ? ApplyDelta(pPayload, SIZE)
+                           : 0;
+        if(!IS_VALID)
+        {
+            printf("Malformed message of type %u\n", header[0]);
+            break;
+        }
+        messageCount++;
+        byteCount     += sizeof(header) + SIZE;
+        intervalBytes += sizeof(header) + SIZE;
+        if(isDrawing)
+        {
+            Draw();
+        }
+
+        const double NOW = Now();
+        if(NOW - intervalStart >= 1.0)
+        {
+            printf("%.0f bytes/s, tick %u, length %u\n", intervalBytes / (NOW - intervalStart), tickCount, length);
+            intervalStart = NOW;
+            intervalBytes = 0;
+        }
+        if(slowMs > 0)
+        {
+            struct timespec delay;
+            delay.tv_sec  = slowMs / 1000;
+            delay.tv_nsec = (slowMs % 1000) * 1000000L;
+            nanosleep(&delay, NULL);
+        }
+    }
+
+    const double SECONDS = Now() - START;
+    printf("disconnected: %u messages, %llu bytes in %.1f s, %.0f bytes/s\n", messageCount, byteCount, SECONDS,
+           (SECONDS > 0.0) ? byteCount / SECONDS : 0.0);
+    free(pPayload);
+    free(pBodyArr);
+    close(SOCKET);
+    return 0;
+}